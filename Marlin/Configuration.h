@@ -1004,6 +1004,14 @@
   // and processor overload (too many expensive sqrt calls).
   #define DEFAULT_SEGMENTS_PER_SECOND 200
 
+  // Replace most inverse kinematics square roots with a Newton step from the last carriage heights.
+  // Meant for boards without a hardware square root, such as AVR and Cortex-M3. Where sqrtf is a
+  // single instruction (Cortex-M4F, x86) it's slower. The Linux planner benchmark measures both.
+  //#define DELTA_FAST_IK
+  #if ENABLED(DELTA_FAST_IK)
+    #define DELTA_FAST_IK_TOLERANCE 0.001 // (mm) Take the exact square root if the step could be off by more
+  #endif
+
   // After homing move down to a height where XY movement is unconstrained
   //#define DELTA_HOME_TO_SAFE_ZONE
 
@@ -2252,6 +2260,8 @@
   //#define UBL_Z_RAISE_WHEN_OFF_MESH 2.5 // When the nozzle is off the mesh, this value is used
                                           // as the Z-Height correction value.
 
+  //#define UBL_SEGMENT_BATCH 8     // Level and queue segmented moves this many at a time, planning each batch once
+
   //#define UBL_MESH_WIZARD         // Run several commands in a row to get a complete mesh
 
   /**
@@ -2455,6 +2465,8 @@
 #if ENABLED(EEPROM_SETTINGS)
   //#define EEPROM_AUTO_INIT  // Init EEPROM automatically on any errors.
   //#define EEPROM_INIT_NOW   // Init EEPROM on first boot after a new build.
+  //#define EEPROM_LOG_STORE  // Write only the changed sections of the settings, spread over flash pages. (STM32F1 flash, Linux HAL)
+                              // STM32F1 keeps to the two EEPROM pages, holding EEPROM_LOG_SIZE (half a page) of settings.
 #endif
 
 // @section host
@@ -3583,6 +3595,13 @@
  */
 //#define SOFT_PWM_DITHER
 
+/**
+ * Sort the soft PWM outputs by the time they turn off at the start of each PWM period,
+ * so the temperature ISR only checks the next output instead of every heater and fan.
+ * Keeps the ISR short on boards with many hotends and FAN_SOFT_PWM fans.
+ */
+//#define SOFT_PWM_SCHEDULE
+
 // @section extras
 
 // Support for the BariCUDA Paste Extruder
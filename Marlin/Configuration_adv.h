@@ -69,6 +69,17 @@
  */
 #define THERMOCOUPLE_MAX_ERRORS 15
 
+/**
+ * ADC Scan Mode
+ * Convert all ADC channels together in one scan on every temperature
+ * interrupt instead of one channel on every other interrupt. The scans
+ * are summed and handed over as a set, so new temperature readings come
+ * in about 10 times as often and the interrupt does less work per call.
+ * Requires a HAL with batched (scan / DMA) ADC acquisition.
+ * Currently supported: STM32F1, LINUX, NATIVE_SIM
+ */
+//#define ADC_SCAN_MODE
+
 //
 // Custom Thermistor 1000 parameters
 //
@@ -170,6 +181,19 @@
   #define REDUNDANT_SH_C_COEFF               0 // Steinhart-Hart C coefficient
 #endif
 
+/**
+ * Custom thermistor lookup table
+ * Convert custom (1000) thermistor readings with a table instead of
+ * evaluating Steinhart-Hart for every reading. The table is rebuilt when
+ * M305 changes the sensor parameters, and M305 reports its precision.
+ * Cells are finest at the ends of the ADC range, where the curve is steepest.
+ */
+//#define USER_THERMISTOR_LUT
+#if ENABLED(USER_THERMISTOR_LUT)
+  #define USER_THERMISTOR_LUT_BITS 3  // (2..5) Cells per octave of the ADC range, as a power of 2. Each step up
+                                      // doubles RAM (~360 bytes per sensor at 3) and cuts the error by ~4x (3: ±0.2°C below 300°C).
+#endif
+
 /**
  * Thermocouple Options — for MAX6675 (-2), MAX31855 (-3), and MAX31865 (-5).
  */
@@ -1148,6 +1172,7 @@
   #define FTM_SHAPING_V_TOL_Y           0.05f     // Vibration tolerance used by EI input shapers for Y axis
 
   //#define FT_MOTION_MENU                        // Provide a MarlinUI menu to set M493 parameters
+  //#define FTM_ARC_BLOCKS                        // Queue G2/G3 as arc blocks that FT Motion traces, instead of many short lines
 
   /**
    * Advanced configuration
@@ -1404,6 +1429,17 @@
  */
 //#define ADAPTIVE_STEP_SMOOTHING
 
+/**
+ * Stepper Ramp Tables have the planner precompute the stepper timer intervals for acceleration and
+ * deceleration as a short table per block, so the Stepper ISR follows the ramp without a multiply and
+ * divide for every step. This allows higher step rates before multi-stepping has to kick in.
+ * Requires a 32-bit CPU. Not compatible with S_CURVE_ACCELERATION, LIN_ADVANCE or NONLINEAR_EXTRUSION.
+ */
+//#define STEPPER_RAMP_TABLES
+#if ENABLED(STEPPER_RAMP_TABLES)
+  #define RAMP_TABLE_SEGMENTS 16  // (1..32) Linear runs per ramp. Each run adds 16 bytes to every planner block.
+#endif
+
 /**
  * Custom Microstepping
  * Override as-needed for your setup. Up to 3 MS pins are supported.
@@ -1739,6 +1775,18 @@
 
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
 
+  // Read G-code from the file a buffer at a time instead of a character at a time.
+  // Refills are whole 512-byte blocks, which helps dense G-code keep up on slow SPI cards.
+  //#define SDCARD_READ_BUFFER_SIZE 512     // (bytes) A multiple of 512. Uses as much SRAM.
+
+  // Keep FAT and directory lookups from evicting the print file's data block.
+  // Adds two read-ahead block slots (1K SRAM) and maps the print file's cluster
+  // chain when it's opened, so reads never stop for FAT lookups at cluster boundaries.
+  //#define SD_READ_AHEAD
+  #if ENABLED(SD_READ_AHEAD)
+    #define SD_CLUSTER_EXTENTS 8            // Contiguous cluster runs mapped. Fragmented files fall back to the FAT.
+  #endif
+
   #define SD_FINISHED_STEPPERRELEASE true   // Disable steppers when SD Print is finished
   #define SD_FINISHED_RELEASECOMMAND "M84"  // Use "M84XYE" to keep Z enabled so your bed stays in place
 
@@ -1787,6 +1835,14 @@
     // especially with "vase mode" printing. Set too high and vases cannot be continued.
     #define POWER_LOSS_MIN_Z_CHANGE    0.05 // (mm) Minimum Z change before saving power-loss data
 
+    // Append small records of the changing state (SD position, position, feedrate, temperatures)
+    // to the power-loss file instead of rewriting it on every save, with a full save when other
+    // state changes or the journal is full. Saves cause shorter stalls, so they can be more frequent.
+    //#define POWER_LOSS_JOURNAL
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      #define POWER_LOSS_JOURNAL_SIZE    64 // Records between full saves (1-255)
+    #endif
+
     //#define BACKUP_POWER_SUPPLY           // Backup power / UPS to move the steppers on power-loss
     #if ENABLED(BACKUP_POWER_SUPPLY)
       //#define POWER_LOSS_RETRACT_LEN   10 // (mm) Length of filament to retract on fail
@@ -1936,6 +1992,8 @@
   #if ENABLED(BINARY_FILE_TRANSFER)
     // Include extra facilities (e.g., 'M20 F') supporting firmware upload via BINARY_FILE_TRANSFER
     //#define CUSTOM_FIRMWARE_UPLOAD
+    // Print (optionally heatshrink-compressed) G-code streamed over the binary protocol, bypassing the SD card
+    //#define BINARY_GCODE_STREAM
   #endif
 
   // "Over-the-air" Firmware Update with M936 - Required to set EEPROM flag
@@ -2572,6 +2630,9 @@
  * Preparing your G-code: https://github.com/colinrgodsey/step-daemon
  */
 //#define DIRECT_STEPPING
+#if ALL(DIRECT_STEPPING, HAS_MEDIA)
+  //#define DIRECT_STEPPING_FILES   // Print files of G6 moves and page writes saved from the Step Daemon stream
+#endif
 
 /**
  * G38 Probe Target
@@ -2661,6 +2722,18 @@
 #define MAX_CMD_SIZE 96
 #define BUFSIZE 4
 
+/**
+ * Store queued commands end-to-end in one shared buffer instead of giving
+ * each command MAX_CMD_SIZE bytes. BUFSIZE is then just the most commands
+ * that can be queued, so many more short moves fit in the same RAM.
+ * e.g., BUFSIZE 16 with a 384 byte arena queues about 12 typical G1 lines
+ * in the RAM used by 4 commands without the arena.
+ */
+//#define COMMAND_ARENA
+#if ENABLED(COMMAND_ARENA)
+  #define COMMAND_ARENA_SIZE 384  // (bytes) At least 2 * MAX_CMD_SIZE
+#endif
+
 /**
  * Host Transmit Buffer Size
  *  - Costs 386 bytes of flash and TX_BUFFER_SIZE+3 bytes of SRAM (if not 0).
@@ -2743,6 +2816,9 @@
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
 //#define ADVANCED_OK
 
+// Let a host stream ahead and get one "ok N<line>" for several numbered lines. Set up with M577.
+//#define SERIAL_ACK_WINDOW
+
 // Printrun may have trouble receiving long strings all at once.
 // This option inserts short delays between lines of serial output.
 #define SERIAL_OVERRUN_PROTECTION
@@ -3968,6 +4044,25 @@
   //#define AUTO_REPORT_REDUNDANT // Include the "R" sensor in the auto-report
 #endif
 
+/**
+ * Auto-report planner statistics with M153 S<seconds>
+ * Queue depth, planner starvation while commands are waiting, look-ahead
+ * time and trapezoid recompute rates. Use it to tell whether stutter comes
+ * from the host / media feeding commands too slowly or from the planner.
+ */
+//#define AUTO_REPORT_PLANNER_STATS
+
+/**
+ * Profile G-code handlers with M156
+ * Count calls, total and worst time for each command. Times include any
+ * waiting done by the handler, so G1 shows how long the planner was full.
+ * Use 'M156' for a report, 'M156 R' to report and restart.
+ */
+//#define GCODE_PROFILER
+#if ENABLED(GCODE_PROFILER)
+  #define GCODE_PROFILER_SLOTS 24   // Commands to track (1-255). Others are counted together.
+#endif
+
 /**
  * Auto-report position with M154 S<seconds>
  */
@@ -3997,6 +4092,7 @@
 #define FASTER_GCODE_PARSER
 #if ENABLED(FASTER_GCODE_PARSER)
   //#define GCODE_QUOTED_STRINGS  // Support for quoted string parameters
+  //#define GCODE_PREPARSED_MOVES // Convert G0-G3 values to floats as moves are queued instead of as they run
 #endif
 
 /**
@@ -4004,6 +4100,9 @@
  */
 //#define MEATPACK_ON_SERIAL_PORT_1
 //#define MEATPACK_ON_SERIAL_PORT_2
+#if ANY(MEATPACK_ON_SERIAL_PORT_1, MEATPACK_ON_SERIAL_PORT_2)
+  //#define MEATPACK_BINARY_FRAMES  // Accept binary command frames, with G0/G1 values sent as floats or deltas
+#endif
 
 //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
 
@@ -0,0 +1,283 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PLANNER_BENCHMARK)
+
+#include "benchmark.h"
+#include "../../MarlinCore.h"
+#include "../../gcode/queue.h"
+#include "../../module/planner.h"
+#include "../../module/motion.h"
+#include "../../module/temperature.h"
+#if ENABLED(FT_MOTION)
+  #include "../../module/ft_motion.h"
+#endif
+#if ENABLED(DELTA_FAST_IK)
+  #include "../../module/delta.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+extern void setup();
+
+uint32_t PlannerBenchmark::blocks_retired; // = 0
+#if ENABLED(FT_MOTION)
+  uint32_t PlannerBenchmark::ftm_commands, PlannerBenchmark::ftm_bytes; // = 0
+#endif
+
+static uint64_t thread_cpu_nanos() {
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return uint64_t(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint64_t wall_nanos() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return uint64_t(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+/**
+ * Commands that wait on wall-clock time or on hardware feedback can never
+ * complete without the timer ISRs, so they're dropped from the input.
+ */
+static bool skip_command(const char * const cmd) {
+  static const char * const skipped[] = {
+    "G4", "G28", "G29", "G30", "G33", "G34", "G76",
+    "M0", "M1", "M109", "M190", "M191", "M192", "M303", "M600"
+  };
+  for (const char * const s : skipped) {
+    const size_t len = strlen(s);
+    if (!strncmp(cmd, s, len) && !NUMERIC(cmd[len])) return true;
+  }
+  return false;
+}
+
+/**
+ * Retire the oldest block as if the stepper had just completed it.
+ * idle() is only reached while the firmware waits on the planner,
+ * either for a free block or to synchronize.
+ */
+void PlannerBenchmark::idle() {
+  #if ENABLED(FT_MOTION)
+    // FT Motion takes blocks from the planner itself, so consume its stepper commands instead
+    if (ftMotion.cfg.active) {
+      const int32_t start = ftMotion.stepperCmdBuff_consumeIdx;
+      ft_command_t step_bits, dir_bits;
+      while ((ftMotion.sts_stepperBusy = ftMotion.pop_stepper_command(step_bits, dir_bits)))
+        ftm_commands++;
+      ftm_bytes += (ftMotion.stepperCmdBuff_consumeIdx - start + (FTM_STEPPERCMD_BUFF_BYTES)) % (FTM_STEPPERCMD_BUFF_BYTES);
+      return;
+    }
+  #endif
+  if (planner.get_current_block()) {
+    planner.release_current_block();
+    blocks_retired++;
+  }
+}
+
+#if ENABLED(DELTA_FAST_IK)
+
+  /**
+   * Compare the fast delta inverse kinematics to the exact square roots
+   * over segmented moves between pseudo-random points on the bed.
+   */
+  void PlannerBenchmark::report_delta_ik() {
+    constexpr uint32_t moves = 2000;
+    constexpr float segment_mm = 0.5f;
+    const float radius = _MIN(PRINTABLE_RADIUS, (delta_diagonal_rod - delta_radius) * 0.8f);
+
+    // Build the list of segment end points once so both passes see the same moves
+    uint32_t seed = 1, count = 0;
+    auto random_mm = [&]{
+      seed = seed * 1664525UL + 1013904223UL;
+      return (float(seed >> 8) / float(1UL << 24) * 2 - 1) * radius;
+    };
+    xyz_pos_t * const points = new xyz_pos_t[moves * uint32_t(2 * radius / segment_mm + 1)];
+    xy_pos_t pos{0};
+    for (uint32_t m = 0; m < moves; ++m) {
+      xy_pos_t next;
+      do { next.set(random_mm(), random_mm()); } while (next.magnitude() > radius);
+      const xy_pos_t diff = next - pos;
+      const uint32_t segments = _MAX(1, diff.magnitude() / segment_mm);
+      for (uint32_t i = 1; i <= segments; ++i)
+        points[count++].set(pos.x + diff.x * i / segments, pos.y + diff.y * i / segments, 10);
+      pos = next;
+    }
+
+    abc_float_t * const exact = new abc_float_t[count];
+    uint64_t start = thread_cpu_nanos();
+    for (uint32_t i = 0; i < count; ++i)
+      exact[i].set(DELTA_Z(points[i], A_AXIS), DELTA_Z(points[i], B_AXIS), DELTA_Z(points[i], C_AXIS));
+    const uint64_t exact_ns = thread_cpu_nanos() - start;
+
+    abc_float_t * const fast = new abc_float_t[count];
+    start = thread_cpu_nanos();
+    for (uint32_t i = 0; i < count; ++i)
+      LOOP_ABC(t) fast[i][t] = delta_fast_tower_z(delta_ik_tower[t], points[i]);
+    const uint64_t fast_ns = thread_cpu_nanos() - start;
+
+    float max_error = 0;
+    for (uint32_t i = 0; i < count; ++i) LOOP_ABC(t) NOLESS(max_error, ABS(fast[i][t] - exact[i][t]));
+
+    printf("  Delta IK: %u segments of %.2f mm\n", count, segment_mm);
+    printf("  Delta IK segments/s: %.0f exact  %.0f fast  max error %.6f mm (tolerance %.6f)\n",
+      count / (exact_ns / 1e9), count / (fast_ns / 1e9), max_error, float(DELTA_FAST_IK_TOLERANCE));
+
+    delete [] points; delete [] exact; delete [] fast;
+  }
+
+#endif // DELTA_FAST_IK
+
+/**
+ * Time the Temperature ISR with every soft PWM output at a different duty cycle.
+ * The ISR has nothing to wait on, so it's called directly.
+ */
+void PlannerBenchmark::report_temperature_isr() {
+  constexpr uint32_t calls = 200000;
+  uint8_t outputs = 0;
+
+  #if HAS_HOTEND
+    HOTEND_LOOP() thermalManager.temp_hotend[e].soft_pwm_amount = 10 + 13 * outputs++;
+  #endif
+  TERN_(HAS_HEATED_BED, thermalManager.temp_bed.soft_pwm_amount = 10 + 13 * outputs++);
+  #if ENABLED(FAN_SOFT_PWM)
+    FANS_LOOP(f) thermalManager.soft_pwm_amount_fan[f] = 2 * (5 + 11 * outputs++);
+  #endif
+
+  const uint64_t start = thread_cpu_nanos();
+  for (uint32_t i = 0; i < calls; ++i) Temperature::isr();
+  const uint64_t isr_ns = thread_cpu_nanos() - start;
+
+  printf("  Temperature ISR: %u soft PWM outputs  %.1f ns/call (SOFT_PWM_SCHEDULE %s)\n",
+    outputs, double(isr_ns) / calls, ENABLED(SOFT_PWM_SCHEDULE) ? "on" : "off");
+}
+
+/**
+ * Feed a G-code file through the command queue.
+ * Comments and blank lines are stripped as the serial reader would.
+ */
+bool PlannerBenchmark::feed_file(const char * const path, uint32_t &lines, uint32_t &commands) {
+  FILE * const file = fopen(path, "r");
+  if (!file) return false;
+
+  char line[256];
+  while (fgets(line, sizeof(line), file)) {
+    lines++;
+
+    char *cmd = line;
+    while (*cmd == ' ' || *cmd == '\t') cmd++;
+    char * const semi = strchr(cmd, ';');
+    if (semi) *semi = '\0';
+    for (char *e = cmd + strlen(cmd); e > cmd && (ISEOL(e[-1]) || e[-1] == ' ' || e[-1] == '\t');) *--e = '\0';
+    if (!*cmd || skip_command(cmd)) continue;
+    if (strlen(cmd) >= MAX_CMD_SIZE) cmd[MAX_CMD_SIZE - 1] = '\0';
+
+    while (!queue.ring_buffer.enqueue(cmd)) queue.advance();
+    commands++;
+  }
+  while (queue.has_commands_queued()) queue.advance();
+
+  fclose(file);
+  return true;
+}
+
+int PlannerBenchmark::run(const int argc, char * const argv[]) {
+  if (argc < 2) {
+    printf("Usage: %s <file.gcode> [repeat]\n", argv[0]);
+    return 1;
+  }
+  const char * const path = argv[1];
+  const int repeat = argc > 2 ? _MAX(atoi(argv[2]), 1) : 1;
+
+  // Pull-ups aren't simulated, so hold the kill button released
+  #if HAS_KILL
+    Gpio::set(KILL_PIN, !KILL_PIN_STATE);
+  #endif
+
+  setup();
+
+  // Moves are refused or clamped before homing, and G28 can't run here
+  set_all_homed();
+
+  // Heaters aren't simulated, so extrude cold
+  TERN_(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude = true);
+
+  blocks_retired = 0;
+  TERN_(FT_MOTION, ftm_commands = ftm_bytes = 0);
+  planner.recalculate_count = 0;
+  planner.recalculate_time_ns = 0;
+  planner.recalculate_blocks = 0;
+  planner.recalculate_blocks_max = 0;
+
+  uint32_t lines = 0, commands = 0;
+  const uint64_t wall_start = wall_nanos(), cpu_start = thread_cpu_nanos();
+
+  for (int i = 0; i < repeat; ++i) {
+    if (!feed_file(path, lines, commands)) {
+      printf("Can't open %s\n", path);
+      return 1;
+    }
+  }
+
+  const uint64_t wall_ns = wall_nanos() - wall_start, cpu_ns = thread_cpu_nanos() - cpu_start;
+
+  // Flush the remaining blocks so every planned block is counted
+  planner.synchronize();
+  TERN_(FT_MOTION, idle()); // FT Motion may report idle with its last commands buffered
+
+  const double secs = wall_ns / 1e9;
+  const uint32_t blocks = blocks_retired, recalcs = planner.recalculate_count;
+
+  printf("Planner benchmark: %s x%d (BLOCK_BUFFER_SIZE %d, BUFSIZE %d)\n", path, repeat, BLOCK_BUFFER_SIZE, BUFSIZE);
+  printf("  lines: %u  commands: %u  blocks: %u\n", lines, commands, blocks);
+  printf("  elapsed: %.3f s  blocks/s: %.0f  commands/s: %.0f\n", secs, blocks / secs, commands / secs);
+  printf("  recalculate: %u calls  %.3f ms total  %.3f us/call\n",
+    recalcs, planner.recalculate_time_ns / 1e6, recalcs ? planner.recalculate_time_ns / 1e3 / recalcs : 0.0);
+  printf("  look-ahead blocks touched: %.2f avg  %u max\n",
+    recalcs ? float(planner.recalculate_blocks) / recalcs : 0.0f, planner.recalculate_blocks_max);
+  printf("  CPU per block: %.3f us  (%.3f us of it in recalculate)\n",
+    blocks ? cpu_ns / 1e3 / blocks : 0.0, blocks ? planner.recalculate_time_ns / 1e3 / blocks : 0.0);
+  #if ENABLED(FT_MOTION)
+    if (ftMotion.cfg.active) {
+      // The unpacked format used one word of STEP and DIR bits per command
+      const double motion_secs = double(ftm_commands) / (FTM_STEPPER_FS);
+      printf("  FT Motion: %u commands (%.3f s of motion)  %u bytes  %.2f bytes/command\n",
+        ftm_commands, motion_secs, ftm_bytes, ftm_commands ? double(ftm_bytes) / ftm_commands : 0.0);
+      printf("  FT Motion bytes/s of motion: %.0f packed  %.0f unpacked\n",
+        motion_secs ? ftm_bytes / motion_secs : 0.0, double(sizeof(bits_t(2 * (LOGICAL_AXES))) * (FTM_STEPPER_FS)));
+    }
+  #endif
+  TERN_(DELTA_FAST_IK, report_delta_ik());
+  report_temperature_isr();
+  fflush(stdout);
+
+  return 0;
+}
+
+#endif // PLANNER_BENCHMARK
+#endif // __PLAT_LINUX__
@@ -0,0 +1,65 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Headless planner benchmark for the Linux HAL
+ *
+ * Build with the 'linux_native_benchmark' environment and run:
+ *   program <file.gcode> [repeat]
+ *
+ * The G-code file is fed through GCodeQueue as fast as possible. No timer
+ * ISRs run, so nothing sleeps: whenever the firmware waits for the planner
+ * (buffer full or synchronize) the oldest block is retired instantly, as if
+ * the stepper had just finished it. This keeps the planner buffer saturated
+ * so every new block pays the full look-ahead cost.
+ *
+ * With FT_MOTION active (e.g., M493 S1 at the start of the file) the FT Motion
+ * stepper commands are consumed instead and their packed size is reported.
+ *
+ * With DELTA_FAST_IK the fast inverse kinematics are also timed against the
+ * exact square roots, reporting segments per second and the largest error.
+ *
+ * Last, the Temperature ISR is timed with all heaters and FAN_SOFT_PWM fans on
+ * soft PWM, to compare SOFT_PWM_SCHEDULE against the per-output evaluation.
+ */
+
+#include <stdint.h>
+
+class PlannerBenchmark {
+public:
+  static int run(const int argc, char * const argv[]);
+
+  // Called from idle() by way of hal.idletask()
+  static void idle();
+
+private:
+  static uint32_t blocks_retired;
+  #if ENABLED(FT_MOTION)
+    static uint32_t ftm_commands, ftm_bytes;
+  #endif
+  static bool feed_file(const char * const path, uint32_t &lines, uint32_t &commands);
+  #if ENABLED(DELTA_FAST_IK)
+    static void report_delta_ik();
+  #endif
+  static void report_temperature_isr();
+};
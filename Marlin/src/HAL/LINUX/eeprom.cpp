@@ -32,11 +32,113 @@
   #define MARLIN_EEPROM_SIZE 0x1000 // 4KB of Emulated EEPROM
 #endif
 
+size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE - eeprom_exclude_size; }
+
+#if ENABLED(EEPROM_LOG_STORE)
+
+#include "../shared/eeprom_log.h"
+
+#ifndef EEPROM_LOG_SECTION
+  #define EEPROM_LOG_SECTION 64
+#endif
+
+/**
+ * Flash pages simulated by a file, for the log-structured store.
+ * As with NOR flash, programming can only clear bits.
+ */
+struct SimulatedFlash {
+  static constexpr uint8_t PAGES = 4;
+  static constexpr uint32_t PAGE_SIZE = 0x2000;
+  static constexpr uint8_t WRITE_SIZE = 4;
+
+  static uint8_t image[PAGES][PAGE_SIZE];
+  static bool loaded;
+  static constexpr char filename[] = "eeprom_flash.dat";
+
+  static void load() {
+    if (loaded) return;
+    memset(image, 0xFF, sizeof(image));
+    FILE * flash_file = fopen(filename, "rb");
+    if (flash_file) {
+      fread(image, sizeof(uint8_t), sizeof(image), flash_file);
+      fclose(flash_file);
+    }
+    loaded = true;
+  }
+
+  static bool store(const uint8_t page, const uint32_t offset, const uint32_t size) {
+    FILE * flash_file = fopen(filename, "r+b");
+    if (!flash_file) {
+      flash_file = fopen(filename, "w+b");
+      if (!flash_file) return true;
+      fwrite(image, sizeof(uint8_t), sizeof(image), flash_file);
+    }
+    fseek(flash_file, long(page) * PAGE_SIZE + offset, SEEK_SET);
+    const bool error = fwrite(&image[page][offset], sizeof(uint8_t), size, flash_file) != size;
+    fclose(flash_file);
+    return error;
+  }
+
+  static bool erase(const uint8_t page) {
+    load();
+    memset(image[page], 0xFF, PAGE_SIZE);
+    return store(page, 0, PAGE_SIZE);
+  }
+
+  static bool program(const uint8_t page, const uint32_t offset, const void * const data, const uint32_t size) {
+    load();
+    const uint8_t * const src = (const uint8_t*)data;
+    for (uint32_t i = 0; i < size; ++i) image[page][offset + i] &= src[i];
+    return store(page, offset, size);
+  }
+
+  static void read(const uint8_t page, const uint32_t offset, void * const data, const uint32_t size) {
+    load();
+    memcpy(data, &image[page][offset], size);
+  }
+};
+
+uint8_t SimulatedFlash::image[PAGES][PAGE_SIZE];
+bool SimulatedFlash::loaded; // = false
+
+static EEPROMLog<SimulatedFlash, MARLIN_EEPROM_SIZE, EEPROM_LOG_SECTION> eeprom_log;
+static bool eeprom_mounted; // = false
+
+bool PersistentStore::access_start() {
+  // Read the store on first access, or drop changes that were never committed
+  if (!eeprom_mounted || eeprom_log.is_dirty()) {
+    eeprom_log.mount();
+    eeprom_mounted = true;
+  }
+  return true;
+}
+
+// Write only the sections that changed
+bool PersistentStore::access_finish() { return !eeprom_log.commit(); }
+
+bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
+  for (std::size_t i = 0; i < size; i++)
+    eeprom_log.write(REAL_EEPROM_ADDR(pos + i), value[i]);
+  crc16(crc, value, size);
+  pos += size;
+  return false;
+}
+
+bool PersistentStore::read_data(int &pos, uint8_t *value, const size_t size, uint16_t *crc, const bool writing/*=true*/) {
+  for (std::size_t i = 0; i < size; i++) {
+    const uint8_t c = eeprom_log.read(REAL_EEPROM_ADDR(pos + i));
+    if (writing) value[i] = c;
+    crc16(crc, &c, 1);
+  }
+  pos += size;
+  return false;
+}
+
+#else // !EEPROM_LOG_STORE
+
 uint8_t buffer[MARLIN_EEPROM_SIZE];
 char filename[] = "eeprom.dat";
 
-size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE - eeprom_exclude_size; }
-
 bool PersistentStore::access_start() {
   const char eeprom_erase_value = 0xFF;
   FILE * eeprom_file = fopen(filename, "rb");
@@ -100,5 +202,7 @@ bool PersistentStore::read_data(int &pos, uint8_t *value, const size_t size, uin
   return bytes_read != size;  // return true for any error
 }
 
+#endif // !EEPROM_LOG_STORE
+
 #endif // EEPROM_SETTINGS
 #endif // __PLAT_LINUX__
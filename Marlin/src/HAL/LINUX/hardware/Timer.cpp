@@ -91,6 +91,7 @@ void Timer::disable() {
 }
 
 void Timer::setCompare(uint32_t compare) {
+  if (timerid == 0) { this->compare = compare; return; } // Never init()ed, e.g., by the headless planner benchmark
   uint32_t nsec_offset = 0;
   if (active) {
     nsec_offset = Clock::nanos() - this->start_time; // calculate how long the timer would have been running for
@@ -76,6 +76,7 @@ extern "C" {
 extern "C" void delay(const int ms);
 void delayMicroseconds(unsigned long);
 unsigned long millis();
+unsigned long micros();
 
 // IO functions
 void pinMode(const pin_t, const uint8_t);
@@ -106,7 +106,7 @@ void simulation_loop() {
   }
 }
 
-int main() {
+int main(int argc, char *argv[]) {
   std::thread write_serial (write_serial_thread);
   std::thread read_serial (read_serial_thread);
 
@@ -117,6 +117,12 @@ int main() {
   #endif
 
   Clock::setFrequency(F_CPU);
+
+  #if ENABLED(PLANNER_BENCHMARK)
+    // Headless: no timer ISRs, no simulated hardware, no real-time sleeping
+    Clock::setTimeMultiplier(1.0);
+    exit(PlannerBenchmark::run(argc, argv));
+  #endif
   Clock::setTimeMultiplier(1.0); // some testing at 10x
 
   HAL_timer_init();
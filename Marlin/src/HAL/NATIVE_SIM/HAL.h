@@ -229,6 +229,16 @@ public:
   // The current value of the ADC register
   static uint16_t adc_value();
 
+  #if ENABLED(ADC_SCAN_MODE)
+    // Begin converting all the given channels into 'values'. Simulated with one conversion per channel.
+    static void adc_scan_start(const pin_t pins[], uint16_t values[], const uint8_t count) {
+      for (uint8_t i = 0; i < count; ++i) { adc_start(pins[i]); values[i] = adc_value(); }
+    }
+
+    // Have all the scanned values been written?
+    static bool adc_scan_ready() { return true; }
+  #endif
+
   /**
    * Set the PWM duty cycle for the pin to the given value.
    * No option to invert the duty cycle [default = false]
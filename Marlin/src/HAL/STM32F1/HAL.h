@@ -218,6 +218,16 @@ public:
   // The current value of the ADC register
   static uint16_t adc_value() { return adc_result; }
 
+  #if ENABLED(ADC_SCAN_MODE)
+    // Copy the latest conversions of all the given pins. DMA keeps every channel of the continuous scan current.
+    static void adc_scan_start(const pin_t pins[], uint16_t values[], const uint8_t count) {
+      for (uint8_t i = 0; i < count; ++i) { adc_start(pins[i]); values[i] = adc_result; }
+    }
+
+    // Have all the scanned values been written?
+    static bool adc_scan_ready() { return true; }
+  #endif
+
   /**
    * Set the PWM duty cycle for the pin to the given value.
    * Optionally invert the duty cycle [default = false]
@@ -41,6 +41,92 @@
 #ifndef MARLIN_EEPROM_SIZE
   #define MARLIN_EEPROM_SIZE ((EEPROM_PAGE_SIZE) * 2UL)
 #endif
+
+#if ENABLED(EEPROM_LOG_STORE)
+
+#include "../../shared/eeprom_log.h"
+
+// The log keeps to the two EEPROM pages, so it holds less than a page of settings
+#ifndef EEPROM_LOG_SIZE
+  #define EEPROM_LOG_SIZE ((EEPROM_PAGE_SIZE) / 2)
+#endif
+#ifndef EEPROM_LOG_SECTION
+  #define EEPROM_LOG_SECTION 32
+#endif
+static_assert(EEPROM_LOG_SIZE <= MARLIN_EEPROM_SIZE, "EEPROM_LOG_SIZE must not exceed MARLIN_EEPROM_SIZE.");
+
+size_t PersistentStore::capacity() { return EEPROM_LOG_SIZE - eeprom_exclude_size; }
+
+// The EEPROM pages, reserved at the end of flash by the linker script
+struct FlashPages {
+  static constexpr uint8_t PAGES = 2;
+  static constexpr uint32_t PAGE_SIZE = EEPROM_PAGE_SIZE;
+  static constexpr uint8_t WRITE_SIZE = 2;
+
+  static uint32_t address(const uint8_t page, const uint32_t offset) {
+    return (page ? EEPROM_PAGE1_BASE : EEPROM_PAGE0_BASE) + offset;
+  }
+
+  static bool erase(const uint8_t page) {
+    FLASH_Unlock();
+    const bool error = FLASH_ErasePage(address(page, 0)) != FLASH_COMPLETE;
+    FLASH_Lock();
+    return error;
+  }
+
+  static bool program(const uint8_t page, const uint32_t offset, const void * const data, const uint32_t size) {
+    const uint8_t * const src = (const uint8_t*)data;
+    FLASH_Unlock();
+    bool error = false;
+    for (uint32_t i = 0; i < size && !error; i += 2) {
+      const uint16_t v = src[i] | (src[i + 1] << 8);
+      if (v != 0xFFFF) error = FLASH_ProgramHalfWord(address(page, offset + i), v) != FLASH_COMPLETE; // Erased half-words need no write
+    }
+    FLASH_Lock();
+    return error;
+  }
+
+  static void read(const uint8_t page, const uint32_t offset, void * const data, const uint32_t size) {
+    memcpy(data, (const void*)address(page, offset), size);
+  }
+};
+
+static EEPROMLog<FlashPages, EEPROM_LOG_SIZE, EEPROM_LOG_SECTION> eeprom_log;
+static bool eeprom_mounted; // = false
+
+bool PersistentStore::access_start() {
+  // Read the store on first access, or drop changes that were never committed
+  if (!eeprom_mounted || eeprom_log.is_dirty()) {
+    eeprom_log.mount();
+    eeprom_mounted = true;
+  }
+  return true;
+}
+
+// Write only the sections that changed
+bool PersistentStore::access_finish() { return !eeprom_log.commit(); }
+
+// Settings past EEPROM_LOG_SIZE are dropped, so they fail the CRC when read back
+bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
+  const bool error = pos + size > EEPROM_LOG_SIZE;
+  if (!error) for (size_t i = 0; i < size; ++i) eeprom_log.write(pos + i, value[i]);
+  crc16(crc, value, size);
+  pos += size;
+  return error;
+}
+
+bool PersistentStore::read_data(int &pos, uint8_t *value, const size_t size, uint16_t *crc, const bool writing/*=true*/) {
+  for (size_t i = 0; i < size; ++i) {
+    const uint8_t c = pos + i < EEPROM_LOG_SIZE ? eeprom_log.read(pos + i) : 0xFF;
+    if (writing) value[i] = c;
+    crc16(crc, &c, 1);
+  }
+  pos += size;
+  return pos > int(EEPROM_LOG_SIZE);
+}
+
+#else // !EEPROM_LOG_STORE
+
 size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE - eeprom_exclude_size; }
 
 static uint8_t ram_eeprom[MARLIN_EEPROM_SIZE] __attribute__((aligned(4))) = {0};
@@ -108,5 +194,6 @@ bool PersistentStore::read_data(int &pos, uint8_t *value, const size_t size, uin
   return false;  // return true for any error
 }
 
+#endif // !EEPROM_LOG_STORE
 #endif // FLASH_EEPROM_EMULATION
 #endif // __STM32F1__
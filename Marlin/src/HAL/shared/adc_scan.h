@@ -0,0 +1,75 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include "../../inc/MarlinConfigPre.h"
+
+/**
+ * Batched ADC acquisition
+ *
+ * A HAL supporting ADC_SCAN_MODE converts a whole list of channels in one go:
+ *
+ *   hal.adc_scan_start(pins, values, count) : Begin converting the pins into 'values'
+ *   hal.adc_scan_ready()                    : Have all 'values' been written?
+ *
+ * The Temperature ISR starts one scan per call and adds the finished scan to
+ * an ADCScanHandoff, which sums SAMPLES scans for every channel and hands the
+ * sums over to normal context as a set.
+ *
+ * The handoff has two banks. The ISR adds into one while the other holds the
+ * last set for the reader, which takes the sums and then calls release().
+ * A set that completes before the reader releases the last one is dropped.
+ */
+template<uint8_t CHANNELS, uint8_t SAMPLES>
+class ADCScanHandoff {
+  raw_adc_t sums[2][CHANNELS];
+  volatile uint8_t fill; // The bank being added into by the ISR
+  volatile bool ready;   // The other bank holds a set for the reader
+  uint8_t count;         // Scans added to the fill bank
+
+public:
+  ADCScanHandoff() { reset(); }
+
+  void reset() {
+    ZERO(sums);
+    fill = count = 0;
+    ready = false;
+  }
+
+  // Called from the ISR with a finished scan. Return 'true' when a set is complete.
+  bool add(const uint16_t values[CHANNELS]) {
+    raw_adc_t * const acc = sums[fill];
+    for (uint8_t i = 0; i < CHANNELS; ++i) acc[i] += values[i];
+    if (++count < SAMPLES) return false;
+
+    // Hand the set over, unless the reader still has the last one
+    count = 0;
+    if (!ready) { fill ^= 1; ready = true; }
+    for (uint8_t i = 0; i < CHANNELS; ++i) sums[fill][i] = 0;
+    return true;
+  }
+
+  // Called from normal context. The sums stay valid until release().
+  bool is_ready() const { return ready; }
+  raw_adc_t get(const uint8_t ch) const { return sums[fill ^ 1][ch]; }
+  void release() { ready = false; }
+};
@@ -0,0 +1,258 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Log-structured EEPROM emulation
+ *
+ * The emulated EEPROM is held in RAM and divided into sections of SECTION bytes.
+ * commit() appends a record for each section that changed since the last commit
+ * to the active flash page, so saving settings only programs the changed parts
+ * and doesn't erase anything until the page is full.
+ *
+ * Each commit has a sequence number, and its records end with a commit marker
+ * holding that number. A record's CRC includes the sequence number, and mount()
+ * only applies the records of commits whose marker was written, so a commit
+ * changes all of its sections or none of them.
+ *
+ * When the page is full the latest copy of every section is written to the next
+ * page, which becomes active once its header is written. Pages are used in turn
+ * to spread the erases, and an interrupted write leaves the last state readable:
+ *  - A commit without a marker is dropped, so its sections keep their older copies.
+ *  - A page without a whole header is ignored, so the last active page is still used.
+ *
+ * The FLASH class provides the flash pages:
+ *   FLASH::PAGES, FLASH::PAGE_SIZE : Number and size of the pages to use
+ *   FLASH::WRITE_SIZE              : Programming unit. Records are padded to it.
+ *   FLASH::erase(page)             : Erase a page to 0xFF. Return 'true' on error.
+ *   FLASH::program(page, offset, data, size) : Program erased bytes. Return 'true' on error.
+ *   FLASH::read(page, offset, data, size)    : Read bytes.
+ */
+
+#include "../../libs/crc16.h"
+
+#include <string.h>
+
+template<class FLASH, uint16_t SIZE, uint16_t SECTION>
+class EEPROMLog {
+public:
+  static constexpr uint16_t SECTIONS = SIZE / SECTION;
+
+private:
+  static constexpr uint32_t MAGIC = 0x474F4C45; // "ELOG"
+  static constexpr uint8_t NO_PAGE = 0xFF;
+  static constexpr uint16_t EMPTY = 0xFFFF,
+                            COMMIT = 0xFFFE;     // The section of a commit marker
+
+  static constexpr uint16_t padded(const uint16_t n) { return (n + FLASH::WRITE_SIZE - 1) / FLASH::WRITE_SIZE * FLASH::WRITE_SIZE; }
+
+  typedef struct { uint32_t magic, generation, check; } page_header_t; // Written last, making the page active. 'check' is ~generation.
+  typedef struct { uint16_t section, crc; } record_header_t;      // 'crc' covers the sequence, 'section' and the data
+
+  static constexpr uint16_t HEADER_SIZE = padded(sizeof(page_header_t)),
+                            RECORD_SIZE = padded(sizeof(record_header_t) + SECTION),
+                            RECORDS = (uint32_t(FLASH::PAGE_SIZE) - HEADER_SIZE) / RECORD_SIZE;
+
+  static_assert(SIZE % SECTION == 0, "SIZE must be a multiple of SECTION.");
+  static_assert(FLASH::PAGES >= 2 && FLASH::PAGES < NO_PAGE, "FLASH::PAGES must be from 2 to 254.");
+  static_assert(SECTION >= sizeof(uint16_t), "SECTION must hold a sequence number.");
+  static_assert(RECORDS > SECTIONS + 2, "FLASH::PAGE_SIZE must hold every section, a commit marker, and one more commit.");
+
+  uint8_t data[SIZE];                     // The emulated EEPROM
+  uint8_t dirty[(SECTIONS + 7) / 8];      // Sections changed since the last commit
+  uint8_t page;                           // The active page
+  uint16_t used;                          // Records in the active page
+  uint32_t generation;                    // Generation of the active page
+  uint16_t sequence;                      // Sequence number of the last commit
+
+  bool is_dirty(const uint16_t s) const { return dirty[s >> 3] & (1 << (s & 7)); }
+
+  static uint16_t record_crc(const uint16_t seq, const uint16_t s, const uint8_t * const sdata) {
+    uint16_t crc = 0;
+    crc16(&crc, &seq, sizeof(seq));
+    crc16(&crc, &s, sizeof(s));
+    crc16(&crc, sdata, SECTION);
+    return crc;
+  }
+
+  bool is_empty(const uint16_t s) const {
+    const uint8_t * const sdata = &data[s * SECTION];
+    for (uint16_t i = 0; i < SECTION; ++i) if (sdata[i] != 0xFF) return false;
+    return true;
+  }
+
+  static uint32_t slot_offset(const uint16_t slot) { return HEADER_SIZE + uint32_t(slot) * RECORD_SIZE; }
+
+  static bool program_slot(const uint8_t p, const uint16_t slot, const uint16_t seq, const uint16_t s, const uint8_t * const sdata) {
+    uint8_t rec[RECORD_SIZE];
+    memset(rec, 0xFF, sizeof(rec));
+    const record_header_t head = { s, record_crc(seq, s, sdata) };
+    memcpy(rec, &head, sizeof(head));
+    memcpy(rec + sizeof(head), sdata, SECTION);
+    return FLASH::program(p, slot_offset(slot), rec, RECORD_SIZE);
+  }
+
+  bool program_record(const uint8_t p, const uint16_t slot, const uint16_t seq, const uint16_t s) {
+    return program_slot(p, slot, seq, s, &data[s * SECTION]);
+  }
+
+  // Written after the records of a commit to make them valid.
+  // Zero filled so a partly programmed marker fails its CRC.
+  static bool program_marker(const uint8_t p, const uint16_t slot, const uint16_t seq) {
+    uint8_t mark[SECTION];
+    memset(mark, 0, sizeof(mark));
+    memcpy(mark, &seq, sizeof(seq));
+    return program_slot(p, slot, seq, COMMIT, mark);
+  }
+
+  // Apply the records of commit 'seq' found in slots first to last - 1
+  void apply_commit(const uint16_t first, const uint16_t last, const uint16_t seq) {
+    uint8_t sdata[SECTION];
+    for (uint16_t slot = first; slot < last; ++slot) {
+      record_header_t head;
+      FLASH::read(page, slot_offset(slot), &head, sizeof(head));
+      if (head.section >= SECTIONS) continue;   // Torn record
+      FLASH::read(page, slot_offset(slot) + sizeof(head), sdata, SECTION);
+      if (head.crc == record_crc(seq, head.section, sdata)) // Not part of an unfinished commit
+        memcpy(&data[head.section * SECTION], sdata, SECTION);
+    }
+  }
+
+  // Copy the latest record of every section to the next page and make it active
+  bool compact() {
+    const uint8_t next = page == NO_PAGE ? 0 : (page + 1) % FLASH::PAGES;
+    if (FLASH::erase(next)) return true;
+
+    const uint16_t seq = sequence + 1;
+    uint16_t slot = 0;
+    for (uint16_t s = 0; s < SECTIONS; ++s)
+      if (!is_empty(s) && program_record(next, slot++, seq, s)) return true;
+    if (program_marker(next, slot++, seq)) return true;
+
+    const page_header_t head = { MAGIC, generation + 1, ~(generation + 1) };
+    uint8_t buf[HEADER_SIZE];
+    memset(buf, 0xFF, sizeof(buf));
+    memcpy(buf, &head, sizeof(head));
+    if (FLASH::program(next, 0, buf, HEADER_SIZE)) return true;
+
+    page = next;
+    used = slot;
+    ++generation;
+    sequence = seq;
+    return false;
+  }
+
+public:
+  EEPROMLog() { reset(); }
+
+  // Forget the flash contents. The EEPROM reads as erased.
+  void reset() {
+    memset(data, 0xFF, sizeof(data));
+    clean();
+    page = NO_PAGE;
+    used = generation = 0;
+    sequence = 0;
+  }
+
+  /**
+   * Find the active page and replay its finished commits.
+   * With no active page the EEPROM reads as erased.
+   */
+  void mount() {
+    reset();
+
+    for (uint8_t p = 0; p < FLASH::PAGES; ++p) {
+      page_header_t head;
+      FLASH::read(p, 0, &head, sizeof(head));
+      if (head.magic != MAGIC || head.check != ~head.generation) continue; // Not a page, or a torn header
+      if (page == NO_PAGE || head.generation > generation) {
+        page = p;
+        generation = head.generation;
+      }
+    }
+    if (page == NO_PAGE) return;
+
+    uint16_t first = 0;                       // The first record of the next commit
+    uint8_t mark[SECTION];
+    for (; used < RECORDS; ++used) {
+      record_header_t head;
+      FLASH::read(page, slot_offset(used), &head, sizeof(head));
+      if (head.section == EMPTY) break;       // End of the log
+      if (head.section != COMMIT) continue;   // Records are applied with their marker
+      FLASH::read(page, slot_offset(used) + sizeof(head), mark, SECTION);
+      uint16_t seq;
+      memcpy(&seq, mark, sizeof(seq));
+      if (head.crc != record_crc(seq, COMMIT, mark)) continue; // Torn marker
+      apply_commit(first, used, seq);
+      sequence = seq;
+      first = used + 1;
+    }
+
+    // Unfinished commits used at most one sequence number per slot. Skip past them
+    // so their records don't become part of the next commit.
+    sequence += used - first;
+  }
+
+  uint8_t read(const uint16_t pos) const { return data[pos]; }
+
+  void write(const uint16_t pos, const uint8_t value) {
+    if (data[pos] == value) return;
+    data[pos] = value;
+    const uint16_t s = pos / SECTION;
+    dirty[s >> 3] |= 1 << (s & 7);
+  }
+
+  bool is_dirty() const {
+    for (uint16_t i = 0; i < sizeof(dirty); ++i) if (dirty[i]) return true;
+    return false;
+  }
+
+  // Discard the changes by forgetting about them. Call mount() to read the old values back.
+  void clean() { memset(dirty, 0, sizeof(dirty)); }
+
+  /**
+   * Append the changed sections and a commit marker to the active page,
+   * compacting into the next page when they don't fit. Return 'true' on error.
+   */
+  bool commit() {
+    uint16_t count = 0;
+    for (uint16_t s = 0; s < SECTIONS; ++s) if (is_dirty(s)) ++count;
+    if (!count) return false;
+
+    if (page == NO_PAGE || used + count >= RECORDS) {
+      if (compact()) return true;             // Compaction writes every section
+    }
+    else {
+      // Don't reuse a slot or a sequence number that may be partly written
+      const uint16_t seq = ++sequence;
+      for (uint16_t s = 0; s < SECTIONS; ++s)
+        if (is_dirty(s) && program_record(page, used++, seq, s)) return true;
+      if (program_marker(page, used++, seq)) return true;
+    }
+    clean();
+    return false;
+  }
+
+  // For testing and reporting
+  uint8_t active_page() const { return page; }
+  uint16_t records_used() const { return used; }
+};
@@ -377,6 +377,8 @@ void startOrResumeJob() {
     queue.clear();
     quickstop_stepper();
 
+    TERN_(DIRECT_STEPPING_FILES, page_manager.reset_media_pages()); // Pages of discarded moves won't be freed
+
     print_job_timer.abort();
 
     IF_DISABLED(SD_ABORT_NO_COOLDOWN, thermalManager.disable_all_heaters());
@@ -857,6 +859,7 @@ void idle(const bool no_stepper_sleep/*=false*/) {
       TERN_(AUTO_REPORT_FANS, fan_check.auto_reporter.tick());
       TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
       TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
+      TERN_(AUTO_REPORT_PLANNER_STATS, planner.stats_auto_reporter.tick());
       TERN_(BUFFER_MONITORING, queue.auto_report_buffer_statistics());
     }
   #endif
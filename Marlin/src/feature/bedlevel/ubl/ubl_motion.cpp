@@ -348,6 +348,7 @@
   /**
    * Prepare a segmented linear move for DELTA/SCARA/CARTESIAN with UBL and FADE semantics.
    * This calls planner.buffer_segment multiple times for small incremental moves.
+   * With UBL_SEGMENT_BATCH the leveled segments are queued and planned in batches.
    * Returns true if did NOT move, false if moved (requires current_position update).
    */
 
@@ -386,13 +387,30 @@
 
     xyze_pos_t raw = current_position;
 
+    #if HAS_PLANNER_BATCH
+      // Segments are gathered here and planned UBL_SEGMENT_BATCH at a time
+      xyze_pos_t batch[UBL_SEGMENT_BATCH];
+      uint8_t batched = 0;
+      auto queue_segment = [&](const xyze_pos_t &seg, const bool last) {
+        batch[batched++] = seg;
+        if (last || batched == COUNT(batch)) {
+          planner.buffer_lines(batch, batched, scaled_fr_mm_s, active_extruder, hints);
+          batched = 0;
+        }
+      };
+    #else
+      auto queue_segment = [&](const xyze_pos_t &seg, const bool) {
+        planner.buffer_line(seg, scaled_fr_mm_s, active_extruder, hints);
+      };
+    #endif
+
     // Just do plain segmentation if UBL is inactive or the target is above the fade height
     if (!planner.leveling_active || !planner.leveling_active_at_z(destination.z)) {
       while (--segments) {
         raw += diff;
-        planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints);
+        queue_segment(raw, false);
       }
-      planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, hints);
+      queue_segment(destination, true);
       return false; // Did not set current from destination
     }
 
@@ -463,7 +481,7 @@
           TERN_(ENABLE_LEVELING_FADE_HEIGHT, * fade_scaling_factor); // apply fade factor to interpolated height
 
         const float oldz = raw.z; raw.z += z_cxcy;
-        planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints);
+        queue_segment(raw, segments == 0);
         raw.z = oldz;
 
         if (segments == 0)                        // done with last segment
@@ -31,6 +31,19 @@ char* SDFileTransferProtocol::Packet::Open::data = nullptr;
 size_t SDFileTransferProtocol::data_waiting, SDFileTransferProtocol::transfer_timeout, SDFileTransferProtocol::idle_timeout;
 bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_transfer, SDFileTransferProtocol::compression;
 
+#if ENABLED(BINARY_GCODE_STREAM)
+  char *GCodeStreamProtocol::input; // = nullptr
+  uint16_t GCodeStreamProtocol::input_index, GCodeStreamProtocol::input_length,
+           GCodeStreamProtocol::output_index, GCodeStreamProtocol::output_length;
+  bool GCodeStreamProtocol::stream_active, GCodeStreamProtocol::compression,
+       GCodeStreamProtocol::poll_more, GCodeStreamProtocol::finish_line;
+  char GCodeStreamProtocol::line_buffer[MAX_CMD_SIZE];
+  uint8_t GCodeStreamProtocol::line_state;
+  int GCodeStreamProtocol::line_index;
+  uint32_t GCodeStreamProtocol::bytes_in, GCodeStreamProtocol::bytes_out, GCodeStreamProtocol::lines;
+  millis_t GCodeStreamProtocol::start_ms, GCodeStreamProtocol::last_ms;
+#endif
+
 BinaryStream binaryStream[NUM_SERIAL];
 
 #endif
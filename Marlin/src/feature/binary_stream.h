@@ -197,9 +197,162 @@ public:
   static const uint16_t version_major = 0, version_minor = 1, version_patch = 0, timeout = 10000, idle_period = 1000;
 };
 
+#if ENABLED(BINARY_GCODE_STREAM)
+
+/**
+ * Print G-code streamed from the host, optionally heatshrink-compressed.
+ *
+ * A WRITE payload stays in the packet buffer and is decoded on demand by
+ * GCodeQueue, which takes no new serial input until the payload is used up.
+ * The host may send the next packet on "ok<sync>", so one packet waits in
+ * the serial buffer while the previous one fills the command queue.
+ */
+class GCodeStreamProtocol {
+private:
+  enum class GCodeStream : uint8_t { QUERY, OPEN, CLOSE, WRITE, ABORT };
+
+  static char *input;
+  static uint16_t input_index, input_length, output_index, output_length;
+  static bool stream_active, compression, poll_more, finish_line;
+
+  // Terminate a last line that has no newline once the stream is closed
+  static int16_t end_of_data() {
+    if (!finish_line) return -1;
+    finish_line = false;
+    return '\n';
+  }
+
+  static void stream_open(const bool compressed) {
+    stream_active = true;
+    compression = compressed;
+    input_index = input_length = output_index = output_length = 0;
+    poll_more = finish_line = false;
+    line_state = line_index = 0;
+    bytes_in = bytes_out = lines = 0;
+    start_ms = last_ms = millis();
+    TERN_(BINARY_STREAM_COMPRESSION, heatshrink_decoder_reset(&hsd));
+  }
+
+public:
+  // The partial line for GCodeQueue, kept out of the command queue until it's
+  // complete so other commands can be queued meanwhile. OPEN and ABORT drop it.
+  static char line_buffer[MAX_CMD_SIZE];
+  static uint8_t line_state;
+  static int line_index;
+
+  // Totals for the current or last stream
+  static uint32_t bytes_in, bytes_out, lines;
+  static millis_t start_ms, last_ms;
+
+  // True while the last packet still has G-code for the queue
+  static bool pending() { return input_index < input_length || output_index < output_length || poll_more || finish_line; }
+
+  // Get the next character of G-code, or -1 if the packet is used up
+  static int16_t get() {
+    #if ENABLED(BINARY_STREAM_COMPRESSION)
+      if (compression) {
+        while (output_index == output_length) {
+          if (!poll_more && input_index == input_length) return end_of_data();
+          size_t count;
+          if (input_index < input_length) {
+            heatshrink_decoder_sink(&hsd, reinterpret_cast<uint8_t*>(&input[input_index]), input_length - input_index, &count);
+            input_index += count;
+          }
+          poll_more = heatshrink_decoder_poll(&hsd, decode_buffer, sizeof(decode_buffer), &count) == HSDR_POLL_MORE;
+          output_index = 0;
+          output_length = count;
+        }
+        bytes_out++;
+        return decode_buffer[output_index++];
+      }
+    #endif
+    if (input_index == input_length) return end_of_data();
+    bytes_out++;
+    return uint8_t(input[input_index++]);
+  }
+
+  static void line_queued() { lines++; last_ms = millis(); }
+
+  static void stream_abort() {
+    if (!stream_active && !pending()) return;
+    stream_active = poll_more = finish_line = false;
+    input_index = input_length = output_index = output_length = 0;
+    line_state = line_index = 0;
+    TERN_(BINARY_STREAM_COMPRESSION, heatshrink_decoder_finish(&hsd));
+  }
+
+  /**
+   * Report the buffers that pace the stream and the totals of the last stream:
+   *   buffer  Largest packet payload
+   *   window  Packets in flight before an "ok<sync>" is needed
+   *   queue   Commands buffered ahead of the planner (BUFSIZE)
+   */
+  static void report() {
+    SERIAL_ECHOLN(F("PGS:buffer:"), MAX_CMD_SIZE, F(":window:1:queue:"), BUFSIZE);
+    const millis_t ms = last_ms - start_ms;
+    SERIAL_ECHOLN(F("PGS:stats:in:"), bytes_in, F(":out:"), bytes_out, F(":lines:"), lines, F(":ms:"), ms,
+      F(":rate:"), uint32_t(ms ? uint64_t(bytes_out) * 1000 / ms : 0));
+  }
+
+  static void process(uint8_t packet_type, char *buffer, const uint16_t length) {
+    switch (static_cast<GCodeStream>(packet_type)) {
+      case GCodeStream::QUERY:
+        SERIAL_ECHO(F("PGS:version:"), version_major, C('.'), version_minor, C('.'), version_patch);
+        #if ENABLED(BINARY_STREAM_COMPRESSION)
+          SERIAL_ECHOLN(F(":compression:heatshrink,"), HEATSHRINK_STATIC_WINDOW_BITS, C(','), HEATSHRINK_STATIC_LOOKAHEAD_BITS);
+        #else
+          SERIAL_ECHOLNPGM(":compression:none");
+        #endif
+        report();
+        break;
+      case GCodeStream::OPEN:
+        if (stream_active)
+          SERIAL_ECHOLNPGM("PGS:busy");
+        else if (length < 1 || card.isFileOpen()) // Not while an SD file is open for printing or writing
+          SERIAL_ECHOLNPGM("PGS:fail");
+        else {
+          stream_open(buffer[0] & 0x1);
+          SERIAL_ECHOLNPGM("PGS:success");
+        }
+        break;
+      case GCodeStream::CLOSE:
+        if (stream_active) {
+          stream_active = false;
+          finish_line = line_index > 0;
+          TERN_(BINARY_STREAM_COMPRESSION, heatshrink_decoder_finish(&hsd));
+          SERIAL_ECHOLNPGM("PGS:success");
+          report();
+        }
+        else SERIAL_ECHOLNPGM("PGS:invalid");
+        break;
+      case GCodeStream::WRITE:
+        if (!stream_active)
+          SERIAL_ECHOLNPGM("PGS:invalid");
+        else {
+          input = buffer;
+          input_index = 0;
+          input_length = length;
+          bytes_in += length;
+        }
+        break;
+      case GCodeStream::ABORT:
+        stream_abort();
+        SERIAL_ECHOLNPGM("PGS:success");
+        break;
+      default:
+        SERIAL_ECHOLNPGM("PGS:invalid");
+        break;
+    }
+  }
+
+  static const uint16_t version_major = 0, version_minor = 1, version_patch = 0;
+};
+
+#endif // BINARY_GCODE_STREAM
+
 class BinaryStream {
 public:
-  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER };
+  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER, GCODE_STREAM };
 
   enum class ProtocolControl : uint8_t { SYNC = 1, CLOSE };
 
@@ -396,6 +549,9 @@ public:
           SERIAL_ECHOLNPGM("ok", packet.header.sync); // transmit valid packet received
           dispatch();
           stream_state = StreamState::PACKET_RESET;
+          #if ENABLED(BINARY_GCODE_STREAM)
+            if (GCodeStreamProtocol::pending()) return; // the queue needs the packet buffer until it's decoded
+          #endif
           break;
         case StreamState::PACKET_RESEND:
           if (packet_retries < max_retries || max_retries == 0) {
@@ -428,6 +584,7 @@ public:
         switch (static_cast<ProtocolControl>(packet.header.type())) {
           case ProtocolControl::CLOSE: // revert back to ASCII mode
             card.flag.binary_mode = false;
+            TERN_(BINARY_GCODE_STREAM, GCodeStreamProtocol::stream_abort());
             break;
           default:
             SERIAL_ECHO_MSG("Unknown BinaryProtocolControl Packet");
@@ -436,6 +593,11 @@ public:
       case Protocol::FILE_TRANSFER:
         SDFileTransferProtocol::process(packet.header.type(), packet.buffer, packet.header.size); // send user data to be processed
       break;
+      #if ENABLED(BINARY_GCODE_STREAM)
+        case Protocol::GCODE_STREAM:
+          GCodeStreamProtocol::process(packet.header.type(), packet.buffer, packet.header.size);
+          break;
+      #endif
       default:
         SERIAL_ECHO_MSG("Unsupported Binary Protocol");
     }
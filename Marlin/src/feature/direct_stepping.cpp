@@ -28,6 +28,10 @@
 
 #include "../MarlinCore.h"
 
+#if ENABLED(DIRECT_STEPPING_FILES)
+  #include "../sd/cardreader.h"
+#endif
+
 #define CHECK_PAGE(I, R) do{                                \
   if (I >= sizeof(page_states) / sizeof(page_states[0])) {  \
     fatal_error = true;                                     \
@@ -72,6 +76,14 @@ namespace DirectStepping {
   template<typename Cfg>
   typename Cfg::write_byte_idx_t SerialPageManager<Cfg>::write_page_size;
 
+  #if ENABLED(DIRECT_STEPPING_FILES)
+    template<typename Cfg>
+    bool SerialPageManager<Cfg>::media_page_wait;
+
+    template<typename Cfg>
+    typename Cfg::page_idx_t SerialPageManager<Cfg>::media_page_idx;
+  #endif
+
   template <typename Cfg>
   void SerialPageManager<Cfg>::init() {
     for (int i = 0 ; i < Cfg::PAGE_COUNT ; i++)
@@ -172,6 +184,59 @@ namespace DirectStepping {
     }
   }
 
+  #if ENABLED(DIRECT_STEPPING_FILES)
+
+    /**
+     * Load a page write from the file being printed, just after its control character.
+     * A file saved from the serial stream has the same page writes, but without a host
+     * to watch the page states, so wait here for the page to be freed by the stepper.
+     * The whole page is read straight into its buffer with a single read.
+     * Return false while waiting for the page. Call again to finish loading it.
+     */
+    template <typename Cfg>
+    bool SerialPageManager<Cfg>::load_media_page() {
+      if (!media_page_wait) {
+        const int16_t c = card.get();
+        if (c < 0) { fatal_error = true; return true; }
+        media_page_idx = c;
+        CHECK_PAGE(media_page_idx, true);
+      }
+
+      media_page_wait = page_states[media_page_idx] != PageState::FREE;
+      if (media_page_wait) return false;
+
+      // Zero means full page size
+      const uint16_t size = Cfg::DIRECTIONAL ? 0 : card.get();
+      const uint16_t page_size = size ? size : Cfg::PAGE_SIZE;
+      uint8_t * const page = pages[media_page_idx];
+
+      set_page_state(media_page_idx, PageState::WRITING);
+      const bool got_page = card.read(page, page_size) == int16_t(page_size);
+      uint8_t sum = 0;
+      for (uint16_t i = 0; i < page_size; ++i) sum ^= page[i];
+
+      // No host to send the page again, so a bad page ends the print
+      if (!got_page || card.get() != sum) { fatal_error = true; return true; }
+
+      set_page_state(media_page_idx, PageState::OK);
+      return true;
+    }
+
+    /**
+     * Forget the page write being loaded and free all pages when a media print
+     * starts or is aborted. An aborted print leaves pages that the stepper never
+     * got to free, and the next print would wait for them forever.
+     * Call with no direct stepping moves in the planner.
+     */
+    template <typename Cfg>
+    void SerialPageManager<Cfg>::reset_media_pages() {
+      media_page_wait = false;
+      media_page_idx = 0;
+      for (page_idx_t i = 0; i < Cfg::PAGE_COUNT; i++) set_page_state(i, PageState::FREE);
+    }
+
+  #endif // DIRECT_STEPPING_FILES
+
   template <typename Cfg>
   void SerialPageManager<Cfg>::write_responses() {
     if (fatal_error) {
@@ -182,6 +247,9 @@ namespace DirectStepping {
     if (!page_states_dirty) return;
     page_states_dirty = false;
 
+    // Pages loaded from a file aren't reported to the host
+    if (TERN0(DIRECT_STEPPING_FILES, card.isStillPrinting())) return;
+
     SERIAL_CHAR(Cfg::CONTROL_CHAR);
     constexpr int state_bits = 2;
     constexpr int n_bytes = Cfg::PAGE_COUNT >> state_bits;
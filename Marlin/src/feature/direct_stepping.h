@@ -56,6 +56,12 @@ namespace DirectStepping {
     static bool maybe_store_rxd_char(uint8_t c);
     static void write_responses();
 
+    #if ENABLED(DIRECT_STEPPING_FILES)
+      static bool load_media_page();
+      static bool media_page_waiting() { return media_page_wait; }
+      static void reset_media_pages();
+    #endif
+
     // common methods for page managers
     static void init();
     static uint8_t *get_page(const page_idx_t page_idx);
@@ -77,6 +83,11 @@ namespace DirectStepping {
     static page_idx_t write_page_idx;
     static write_byte_idx_t write_page_size;
 
+    #if ENABLED(DIRECT_STEPPING_FILES)
+      static bool media_page_wait;
+      static page_idx_t media_page_idx;
+    #endif
+
     static void set_page_state(const page_idx_t page_idx, const PageState page_state);
   };
 
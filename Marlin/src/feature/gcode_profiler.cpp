@@ -0,0 +1,110 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * gcode_profiler.cpp - Count calls and time spent in each G-code handler
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(GCODE_PROFILER)
+
+#include "gcode_profiler.h"
+#include "../gcode/parser.h"
+
+GCodeProfiler gcodeProfiler;
+
+gcode_profile_t GCodeProfiler::slots[GCODE_PROFILER_SLOTS];
+uint8_t GCodeProfiler::used; // = 0
+uint32_t GCodeProfiler::untracked_calls; // = 0
+uint64_t GCodeProfiler::untracked_us; // = 0
+millis_t GCodeProfiler::start_ms; // = 0
+
+/**
+ * Add a handler call to its slot, adding a new slot in order if
+ * there's room. Commands that don't get a slot are counted together.
+ */
+void GCodeProfiler::record(const char letter, const uint16_t codenum, const uint32_t us) {
+  const uint32_t key = (uint32_t(letter) << 16) | codenum;
+  uint8_t lo = 0, hi = used;
+  while (lo < hi) {
+    const uint8_t mid = (lo + hi) / 2;
+    const uint32_t k = (uint32_t(slots[mid].letter) << 16) | slots[mid].codenum;
+    if (k == key) { lo = mid; break; }
+    if (k < key) lo = mid + 1; else hi = mid;
+  }
+
+  gcode_profile_t *s = &slots[lo];
+  if (lo >= used || s->letter != letter || s->codenum != codenum) {
+    if (used >= COUNT(slots)) {
+      untracked_calls++;
+      untracked_us += us;
+      return;
+    }
+    memmove(s + 1, s, (used - lo) * sizeof(gcode_profile_t));
+    used++;
+    *s = { letter, codenum, 0, 0, 0 };
+  }
+
+  s->calls++;
+  s->total_us += us;
+  NOLESS(s->max_us, us);
+}
+
+/**
+ * Report every profiled command, with its share of the time since the last reset:
+ *   <code> N<calls> T<total ms> A<average us> M<max us> P<percent>
+ */
+void GCodeProfiler::report() {
+  const millis_t ms = _MAX(millis() - start_ms, 1UL);
+  SERIAL_ECHOLNPGM("G-code profile: ", used, " commands in ", ms, " ms");
+  for (uint8_t i = 0; i < used; ++i) {
+    const gcode_profile_t &s = slots[i];
+    SERIAL_ECHOLN(
+      C(s.letter), s.codenum,
+      F(" N"), s.calls,
+      F(" T"), uint32_t(s.total_us / 1000),
+      F(" A"), uint32_t(s.total_us / s.calls),
+      F(" M"), s.max_us,
+      F(" P"), p_float_t(s.total_us * 0.1f / ms, 1)
+    );
+  }
+  if (untracked_calls)
+    SERIAL_ECHOLNPGM("Untracked N", untracked_calls, " T", uint32_t(untracked_us / 1000));
+}
+
+GCodeProfiler::Timer::Timer() : start_us(micros()) {}
+
+// M156 itself isn't profiled, so a reset starts with an empty profile
+GCodeProfiler::Timer::~Timer() {
+  if (!parser.is_command('M', 156))
+    record(parser.command_letter, parser.codenum, micros() - start_us);
+}
+
+void GCodeProfiler::reset() {
+  used = 0;
+  untracked_calls = 0;
+  untracked_us = 0;
+  start_ms = millis();
+}
+
+#endif // GCODE_PROFILER
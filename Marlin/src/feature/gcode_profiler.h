@@ -0,0 +1,59 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * gcode_profiler.h - Count calls and time spent in each G-code handler
+ */
+
+#include "../inc/MarlinConfig.h"
+
+typedef struct {
+  char letter;                // 'G', 'M', 'T', ...
+  uint16_t codenum;
+  uint32_t calls, max_us;
+  uint64_t total_us;
+} gcode_profile_t;
+
+class GCodeProfiler {
+public:
+  static void record(const char letter, const uint16_t codenum, const uint32_t us);
+  static void report();
+  static void reset();
+
+  // Record the current parser command when going out of scope
+  struct Timer {
+    uint32_t start_us;
+    Timer();
+    ~Timer();
+  };
+
+private:
+  // Kept sorted by letter and code for a binary search
+  static gcode_profile_t slots[GCODE_PROFILER_SLOTS];
+  static uint8_t used;
+  static uint32_t untracked_calls;
+  static uint64_t untracked_us;
+  static millis_t start_ms;
+};
+
+extern GCodeProfiler gcodeProfiler;
@@ -43,6 +43,10 @@
 
 #include "meatpack.h"
 
+#if ENABLED(MEATPACK_BINARY_FRAMES)
+  #include "../gcode/queue.h"
+#endif
+
 #define MeatPack_ProtocolVersion "PV01"
 //#define MP_DEBUG
 
@@ -62,10 +66,15 @@ uint8_t meatPackLookupTable[16] = {
 #endif
 
 void MeatPack::reset_state() {
+  #if ENABLED(MEATPACK_BINARY_FRAMES)
+    const bool was_binary = TEST(state, MPConfig_Bit_Binary);
+    frame_count = 0;
+  #endif
   state = 0;
   cmd_is_next = false;
   second_char = 0;
   cmd_count = full_char_count = char_out_count = 0;
+  TERN_(MEATPACK_BINARY_FRAMES, if (was_binary) end_frames());
   TERN_(MP_DEBUG, chars_decoded = 0);
 }
 
@@ -100,6 +109,18 @@ uint8_t MeatPack::unpack_chars(const uint8_t pk, uint8_t* __restrict const chars
  * according to the current MeatPack state.
  */
 void MeatPack::handle_rx_char_inner(const uint8_t c) {
+  #if ENABLED(MEATPACK_BINARY_FRAMES)
+    if (TEST(state, MPConfig_Bit_Binary)) {                 // Binary frames replace packing
+      handle_output_char(kFrameMark);                       // Tell the queue a frame starts
+      if (WITHIN(c, kMinFrameLength, kMaxFrameLength)) {
+        handle_output_char(c);                              // The length never needs escaping
+        frame_count = c + 1;                                // The frame and its checksum follow
+      }
+      else
+        handle_output_char(kFrameBad);                      // Let the queue request a resend
+      return;
+    }
+  #endif
   if (TEST(state, MPConfig_Bit_Active)) {                   // Is MeatPack active?
     if (!full_char_count) {                                 // No literal characters to fetch?
       uint8_t buf[2] = { 0, 0 };
@@ -130,6 +151,32 @@ void MeatPack::handle_rx_char_inner(const uint8_t c) {
     handle_output_char(c);
 }
 
+#if ENABLED(MEATPACK_BINARY_FRAMES)
+
+  /**
+   * Pass on a single byte from inside a binary frame,
+   * escaping any byte that could be taken for a mark.
+   */
+  void MeatPack::handle_frame_char(const uint8_t c) {
+    if (c == kFrameMark || c == kFrameEscape) {
+      handle_output_char(kFrameEscape);
+      handle_output_char(c ^ kFrameEscapeXor);
+    }
+    else
+      handle_output_char(c);
+  }
+
+  /**
+   * Tell the queue that binary frames are turned off
+   * so it goes back to reading text.
+   */
+  void MeatPack::end_frames() {
+    handle_output_char(kFrameMark);
+    handle_output_char(kFrameEnd);
+  }
+
+#endif
+
 /**
  * Buffer a single output character which will be picked up in
  * GCodeQueue::get_serial_commands via calls to get_result_char
@@ -161,6 +208,16 @@ void MeatPack::handle_command(const MeatPack_Command c) {
     case MPCommand_DisableNoSpaces:
       CBI(state, MPConfig_Bit_NoSpaces);
       meatPackLookupTable[kSpaceCharIdx] = ' ';                        DEBUG_ECHOLNPGM("[MPDBG] DIS NSP");   break;
+    #if ENABLED(MEATPACK_BINARY_FRAMES)
+      case MPCommand_EnableBinary:
+        SBI(state, MPConfig_Bit_Binary);
+        cmd_count = 0;                                                 DEBUG_ECHOLNPGM("[MPDBG] ENA BIN");   break;
+      case MPCommand_DisableBinary:
+        if (TEST(state, MPConfig_Bit_Binary)) {
+          CBI(state, MPConfig_Bit_Binary);
+          end_frames();
+        }                                                              DEBUG_ECHOLNPGM("[MPDBG] DIS BIN");   break;
+    #endif
     default:                                                           DEBUG_ECHOLNPGM("[MPDBG] UNK CMD REC");
   }
   report_state();
@@ -171,7 +228,11 @@ void MeatPack::report_state() {
   // should not contain the "PV' substring, as this is used to indicate protocol version
   SERIAL_ECHOPGM("[MP] " MeatPack_ProtocolVersion " ");
   serialprint_onoff(TEST(state, MPConfig_Bit_Active));
-  SERIAL_ECHO(TEST(state, MPConfig_Bit_NoSpaces) ? F(" NSP\n") : F(" ESP\n"));
+  SERIAL_ECHO(TEST(state, MPConfig_Bit_NoSpaces) ? F(" NSP") : F(" ESP"));
+  #if ENABLED(MEATPACK_BINARY_FRAMES)
+    SERIAL_ECHO(TEST(state, MPConfig_Bit_Binary) ? F(" BIN") : F(" TXT"));
+  #endif
+  SERIAL_EOL();
 }
 
 /**
@@ -179,6 +240,14 @@ void MeatPack::report_state() {
  * according to the current meatpack state.
  */
 void MeatPack::handle_rx_char(const uint8_t c, const serial_index_t serial_ind) {
+  #if ENABLED(MEATPACK_BINARY_FRAMES)
+    if (frame_count) {                    // Inside a binary frame every byte is data
+      handle_frame_char(c);
+      --frame_count;
+      return;
+    }
+  #endif
+
   if (c == kCommandByte) {                // A command (0xFF) byte?
     if (cmd_count) {                      // In fact, two in a row?
       cmd_is_next = true;                 // Then a MeatPack command follows
@@ -192,6 +261,9 @@ void MeatPack::handle_rx_char(const uint8_t c, const serial_index_t serial_ind)
   if (cmd_is_next) {                      // Were two command bytes received?
     PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));
     handle_command((MeatPack_Command)c);  // Then the byte is a MeatPack command
+    #if ENABLED(MEATPACK_BINARY_FRAMES)
+      if (c == MPCommand_EnableBinary) GCodeQueue::binary_frames_on(serial_ind); // Let the queue take frames from this port
+    #endif
     cmd_is_next = false;
     return;
   }
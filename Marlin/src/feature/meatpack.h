@@ -70,14 +70,53 @@ enum MeatPack_Command : uint8_t {
   MPCommand_ResetAll        = 0xF9,
   MPCommand_QueryConfig     = 0xF8,
   MPCommand_EnableNoSpaces  = 0xF7,
-  MPCommand_DisableNoSpaces = 0xF6
+  MPCommand_DisableNoSpaces = 0xF6,
+  MPCommand_EnableBinary    = 0xF5,
+  MPCommand_DisableBinary   = 0xF4
 };
 
 enum MeatPack_ConfigStateBits : uint8_t {
   MPConfig_Bit_Active   = 0,
-  MPConfig_Bit_NoSpaces = 1
+  MPConfig_Bit_NoSpaces = 1,
+  MPConfig_Bit_Binary   = 2
 };
 
+#if ENABLED(MEATPACK_BINARY_FRAMES)
+
+  /**
+   * Binary frames
+   *
+   * With MPCommand_EnableBinary every command is sent in a frame instead of as text:
+   *
+   *   len      Number of bytes from 'op' through the last field, from 3 to MAX_CMD_SIZE - 2
+   *   op       One of MeatPack_BinaryOp
+   *   N        Low 16 bits of the line number, little-endian
+   *   fields   Depend on 'op'
+   *   check    XOR of all bytes from 'len' through the last field
+   *
+   * An MPBinary_Text frame holds one line of G-code without line number or checksum.
+   * An MPBinary_G0 or MPBinary_G1 frame holds a mask of the fields present, in the order
+   * of MP_BINARY_FIELDS, followed by each value as a little-endian float. With the
+   * MPBinary_Delta flag a second mask follows, marking the fields sent instead as an int16
+   * in thousandths, relative to the value of that field in the last accepted frame.
+   * Hosts should add deltas in single precision to match the firmware.
+   *
+   * Line numbers, checksums, and resend requests work as they do for text. Frames that
+   * aren't accepted leave the delta state unchanged, so resent frames need no re-encoding.
+   * Between frames the usual MeatPack commands may be sent. To recover from lost bytes,
+   * a host may send MAX_CMD_SIZE bytes of 0xFF and then MPCommand_EnableBinary.
+   */
+  enum MeatPack_BinaryOp : uint8_t {
+    MPBinary_Text  = 0x00,
+    MPBinary_G0    = 0x01,
+    MPBinary_G1    = 0x02,
+    MPBinary_Delta = 0x80
+  };
+
+  #define MP_BINARY_FIELDS "XYZEF"
+
+#endif
+
 class MeatPack {
 
   // Utility definitions
@@ -90,13 +129,35 @@ class MeatPack {
   static const uint8_t kSpaceCharIdx = 11;
   static const char kSpaceCharReplace = 'E';
 
+public:
+  // A stray command byte ahead of a frame length puts out two marks and two lengths
+  static const uint8_t kOutBufferSize = TERN(MEATPACK_BINARY_FRAMES, 4, 2);
+
+  #if ENABLED(MEATPACK_BINARY_FRAMES)
+    // Frames are passed on to GCodeQueue after a mark byte that can't appear anywhere else,
+    // so the queue can find the next frame after an error. Frame bytes equal to kFrameMark
+    // or kFrameEscape are sent as kFrameEscape followed by the byte XOR kFrameEscapeXor.
+    static const uint8_t kFrameMark      = 0x01,
+                         kFrameEscape    = 0x02,
+                         kFrameEscapeXor = 0x20,
+                         kMinFrameLength = 3,
+                         kMaxFrameLength = _MIN(MAX_CMD_SIZE, 256) - 2,
+                         kFrameBad       = 0x00, // Sent in place of a bad frame length
+                         kFrameEnd       = 0xFF; // Sent in place of a length when frames are turned off
+  #endif
+
+private:
+
   bool cmd_is_next;        // A command is pending
   uint8_t state;           // Configuration state
   uint8_t second_char;     // Buffers a character if dealing with out-of-sequence pairs
   uint8_t cmd_count,       // Counter of command bytes received (need 2)
           full_char_count, // Counter for full-width characters to be received
           char_out_count;  // Stores number of characters to be read out.
-  uint8_t char_out_buf[2]; // Output buffer for caching up to 2 characters
+  uint8_t char_out_buf[kOutBufferSize]; // Output buffer for caching up to 2 characters (4 with binary frames)
+  #if ENABLED(MEATPACK_BINARY_FRAMES)
+    uint8_t frame_count;   // Binary frame bytes still to be received
+  #endif
 
 public:
   // Pass in a character rx'd by SD card or serial. Automatically parses command/ctrl sequences,
@@ -105,7 +166,7 @@ public:
 
   /**
    * After passing in rx'd char using above method, call this to get characters out.
-   * Can return from 0 to 2 characters at once.
+   * Can return from 0 to 2 characters at once (up to 4 with binary frames).
    * @param out [in] Output pointer for unpacked/processed data.
    * @return Number of characters returned. Range from 0 to 2.
    */
@@ -117,8 +178,13 @@ public:
   void handle_command(const MeatPack_Command c);
   void handle_output_char(const uint8_t c);
   void handle_rx_char_inner(const uint8_t c);
+  #if ENABLED(MEATPACK_BINARY_FRAMES)
+    void handle_frame_char(const uint8_t c);
+    void end_frames();
+  #endif
 
-  MeatPack() : cmd_is_next(false), state(0), second_char(0), cmd_count(0), full_char_count(0), char_out_count(0) {}
+  MeatPack() : cmd_is_next(false), state(0), second_char(0), cmd_count(0), full_char_count(0), char_out_count(0)
+    OPTARG(MEATPACK_BINARY_FRAMES, frame_count(0)) {}
 };
 
 // Implement the MeatPack serial class so it's transparent to rest of the code
@@ -129,7 +195,7 @@ struct MeatpackSerial : public SerialBase <MeatpackSerial < SerialT >> {
   SerialT & out;
   MeatPack meatpack;
 
-  char serialBuffer[2];
+  char serialBuffer[MeatPack::kOutBufferSize];
   uint8_t charCount;
   uint8_t readIndex;
 
@@ -163,7 +229,7 @@ struct MeatpackSerial : public SerialBase <MeatpackSerial < SerialT >> {
     if (charCount == 0 && available(index) == 0) return -1;
 
     charCount--;
-    return serialBuffer[readIndex++];
+    return uint8_t(serialBuffer[readIndex++]); // Binary frame bytes can be 0x80 or higher
   }
 
   int read(serial_index_t index)  { return readImpl(index); }
@@ -53,6 +53,12 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   bool PrintJobRecovery::ui_flag_resume; // = false
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  uint8_t PrintJobRecovery::journal_count = POWER_LOSS_JOURNAL_SIZE;
+  uint16_t PrintJobRecovery::journal_state; // = 0
+  #include "../libs/crc16.h"
+#endif
+
 #include "../sd/cardreader.h"
 #include "../lcd/marlinui.h"
 #include "../gcode/queue.h"
@@ -99,7 +105,10 @@ PrintJobRecovery recovery;
 /**
  * Clear the recovery info
  */
-void PrintJobRecovery::init() { info = {}; }
+void PrintJobRecovery::init() {
+  info = {};
+  TERN_(POWER_LOSS_JOURNAL, journal_reset());
+}
 
 /**
  * Enable or disable then call changed()
@@ -156,6 +165,7 @@ void PrintJobRecovery::load() {
   if (exists()) {
     open(true);
     (void)file.read(&info, sizeof(info));
+    TERN_(POWER_LOSS_JOURNAL, journal_replay());
     close();
   }
   debug(F("Load"));
@@ -167,6 +177,7 @@ void PrintJobRecovery::load() {
 void PrintJobRecovery::prepare() {
   card.getAbsFilenameInCWD(info.sd_filename);  // SD filename
   cmd_sdpos = 0;
+  TERN_(POWER_LOSS_JOURNAL, journal_reset());
 }
 
 /**
@@ -200,10 +211,12 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
       next_save_ms = ms + SAVE_INFO_INTERVAL_MS;
     #endif
 
-    // Set Head and Foot to matching non-zero values
-    if (!++info.valid_head) ++info.valid_head; // non-zero in sequence
-    //if (!card.isStillPrinting()) info.valid_head = 0;
-    info.valid_foot = info.valid_head;
+    #if DISABLED(POWER_LOSS_JOURNAL)   // Journal records keep the checkpoint's Head and Foot
+      // Set Head and Foot to matching non-zero values
+      if (!++info.valid_head) ++info.valid_head; // non-zero in sequence
+      //if (!card.isStillPrinting()) info.valid_head = 0;
+      info.valid_foot = info.valid_head;
+    #endif
 
     // Machine state
     // info.sdpos and info.current_position are pre-filled from the Stepper ISR
@@ -352,11 +365,125 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
 
 #endif // POWER_LOSS_PIN || DEBUG_POWER_LOSS_RECOVERY
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  /**
+   * Copy the journaled fields from recovery info to a record, or from a record to recovery info
+   */
+  void PrintJobRecovery::journal_copy(job_recovery_info_t &ji, job_recovery_journal_t &rec, const bool to_info) {
+    #define _JCOPY(F) do{ \
+      if (to_info) memcpy((void*)&ji.F, &rec.F, sizeof(rec.F)); \
+      else memcpy(&rec.F, (void*)&ji.F, sizeof(rec.F)); \
+    }while(0)
+    _JCOPY(sdpos);
+    _JCOPY(current_position);
+    _JCOPY(feedrate);
+    _JCOPY(print_job_elapsed);
+    TERN_(HAS_HOTEND, _JCOPY(target_temperature));
+    TERN_(HAS_HEATED_BED, _JCOPY(target_temperature_bed));
+    TERN_(HAS_HEATED_CHAMBER, _JCOPY(target_temperature_chamber));
+    TERN_(HAS_FAN, _JCOPY(fan_speed));
+    #if ENABLED(FWRETRACT)
+      _JCOPY(retract);
+      _JCOPY(retract_hop);
+    #endif
+    #undef _JCOPY
+  }
+
+  /**
+   * CRC of the checkpoint fields that a record can't change,
+   * leaving out the valid markers and the (unchanging) filename.
+   * The journaled fields are cleared in a copy, so info can be
+   * read by the outage handler while this runs.
+   */
+  uint16_t PrintJobRecovery::journal_state_crc() {
+    job_recovery_info_t state = info;
+    job_recovery_journal_t blank{};
+    journal_copy(state, blank, true);
+
+    const uint8_t * const start = (uint8_t*)&state.current_position,
+                  * const name = (uint8_t*)state.sd_filename,
+                  * const after = name + sizeof(state.sd_filename),
+                  * const foot = &state.valid_foot;
+    uint16_t crc = 0;
+    crc16(&crc, start, name - start);
+    crc16(&crc, after, foot - after);
+    return crc;
+  }
+
+  /**
+   * Fill a record with the journaled fields of info, for the current checkpoint
+   */
+  void PrintJobRecovery::journal_record(job_recovery_journal_t &rec) {
+    rec = {};
+    journal_copy(info, rec, false);
+    rec.valid = info.valid_head;
+    crc16(&rec.crc, &rec, (uint8_t*)&rec.crc - (uint8_t*)&rec);
+  }
+
+  /**
+   * Apply a record that follows the checkpoint in info. Return false, leaving info
+   * unchanged, if the record is incomplete or left over from an older checkpoint.
+   */
+  bool PrintJobRecovery::journal_apply(job_recovery_journal_t &rec) {
+    uint16_t crc = 0;
+    crc16(&crc, &rec, (uint8_t*)&rec.crc - (uint8_t*)&rec);
+    if (rec.crc != crc || rec.valid != info.valid_head || rec.sdpos < info.sdpos) return false;
+    journal_copy(info, rec, true);
+    return true;
+  }
+
+  /**
+   * Apply the records that follow the checkpoint just read, stopping at the first one rejected
+   */
+  void PrintJobRecovery::journal_replay() {
+    journal_reset();
+    if (!info.valid()) return;
+
+    job_recovery_journal_t rec;
+    uint8_t count = 0;
+    while (count < POWER_LOSS_JOURNAL_SIZE && file.read(&rec, sizeof(rec)) == int16_t(sizeof(rec)) && journal_apply(rec))
+      ++count;
+
+    journal_count = count;
+    journal_state = journal_state_crc();
+    DEBUG_ECHOLNPGM("Journal records: ", count);
+  }
+
+#endif // POWER_LOSS_JOURNAL
+
 /**
  * Save the recovery info the recovery file
  */
 void PrintJobRecovery::write() {
 
+  #if ENABLED(POWER_LOSS_JOURNAL)
+
+    // Append a record if only the journaled fields changed since the checkpoint
+    const uint16_t state = journal_state_crc();
+    if (journal_count < POWER_LOSS_JOURNAL_SIZE && state == journal_state) {
+      job_recovery_journal_t rec;
+      journal_record(rec);
+
+      DEBUG_ECHOLNPGM("Journal record ", journal_count);
+
+      open(false);
+      file.seekSet(sizeof(info) + uint32_t(journal_count) * sizeof(rec));
+      const int16_t ret = file.write(&rec, sizeof(rec));
+      if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+      if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+      ++journal_count;
+      return;
+    }
+
+    // Otherwise write a new checkpoint with matching non-zero Head and Foot
+    if (!++info.valid_head) ++info.valid_head;
+    info.valid_foot = info.valid_head;
+    journal_state = state;
+    journal_count = 0;
+
+  #endif
+
   debug(F("Write"));
 
   open(false);
@@ -151,6 +151,39 @@ typedef struct {
 
 } job_recovery_info_t;
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  /**
+   * A journal record holds the recovery info that changes while printing.
+   * Records are appended to the recovery file after the last checkpoint
+   * (a full job_recovery_info_t) and replayed in order by load().
+   */
+  typedef struct {
+    uint8_t valid;                      // The checkpoint's valid_head
+    uint32_t sdpos;
+    xyze_pos_t current_position;
+    uint16_t feedrate;
+    millis_t print_job_elapsed;
+    #if HAS_HOTEND
+      celsius_t target_temperature[HOTENDS];
+    #endif
+    #if HAS_HEATED_BED
+      celsius_t target_temperature_bed;
+    #endif
+    #if HAS_HEATED_CHAMBER
+      celsius_t target_temperature_chamber;
+    #endif
+    #if HAS_FAN
+      uint8_t fan_speed[FAN_COUNT];
+    #endif
+    #if ENABLED(FWRETRACT)
+      float retract[EXTRUDERS], retract_hop;
+    #endif
+    uint16_t crc;                       // CRC of the fields above
+  } job_recovery_journal_t;
+
+#endif
+
 class PrintJobRecovery {
   public:
     static const char filename[5];
@@ -233,9 +266,23 @@ class PrintJobRecovery {
       static void debug(FSTR_P const) {}
     #endif
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static void journal_record(job_recovery_journal_t &rec);
+      static bool journal_apply(job_recovery_journal_t &rec);
+      static uint16_t journal_state_crc();
+    #endif
+
   private:
     static void write();
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static uint8_t journal_count;     //!< Records written since the last checkpoint
+      static uint16_t journal_state;    //!< CRC of the checkpoint fields not in a record
+      static void journal_reset() { journal_count = POWER_LOSS_JOURNAL_SIZE; } // Make the next write a checkpoint
+      static void journal_copy(job_recovery_info_t &ji, job_recovery_journal_t &rec, const bool to_info);
+      static void journal_replay();
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const_float_t zraise);
     #endif
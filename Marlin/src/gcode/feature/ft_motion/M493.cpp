@@ -26,6 +26,7 @@
 
 #include "../../gcode.h"
 #include "../../../module/ft_motion.h"
+#include "../../../module/planner.h"
 #include "../../../module/stepper.h"
 
 void say_shaper_type(const AxisEnum a) {
@@ -199,6 +200,7 @@ void GcodeSuite::M493() {
   if (parser.seen('S')) {
     const bool active = parser.value_bool();
     if (active != ftMotion.cfg.active) {
+      planner.synchronize();  // Queued blocks, like FTM_ARC_BLOCKS arcs, are made for the current mode
       stepper.ftMotion_syncPosition();
       ftMotion.cfg.active = active;
       flag.report = true;
@@ -54,7 +54,7 @@
  *
  *   If no axes are specified then all axes are restored.
  */
-void GcodeSuite::G61(int8_t slot/*=-1*/) {
+void GcodeSuite::G61(int8_t slot) {
 
   if (slot < 0) slot = parser.byteval('S');
 
@@ -69,6 +69,10 @@ GcodeSuite gcode;
   #include "../feature/fancheck.h"
 #endif
 
+#if ENABLED(GCODE_PROFILER)
+  #include "../feature/gcode_profiler.h"
+#endif
+
 #include "../MarlinCore.h" // for idle, kill
 
 // Inactivity shutdown
@@ -316,6 +320,25 @@ void GcodeSuite::dwell(const millis_t time) {
 
 #endif // G29_RETRY_AND_RECOVER
 
+/**
+ * Find the parsed code in a sorted handler table and call its handler.
+ * Return false if the code isn't in the table.
+ */
+bool GcodeSuite::dispatch(const handler_entry_t table[], const uint16_t count) {
+  const uint16_t code = parser.codenum;
+  uint16_t lo = 0, hi = count;
+  while (lo < hi) {
+    const uint16_t mid = (lo + hi) / 2, mid_code = pgm_read_word(&table[mid].code);
+    if (mid_code == code) {
+      const handler_t handler = (handler_t)pgm_read_ptr(&table[mid].handler);
+      if (handler) handler();
+      return true;
+    }
+    if (mid_code < code) lo = mid + 1; else hi = mid;
+  }
+  return false;
+}
+
 /**
  * Process the parsed command and dispatch it to its handler
  */
@@ -343,817 +366,863 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
     }
   #endif
 
+  // Time the handler, including any waiting it does, for M156
+  TERN_(GCODE_PROFILER, GCodeProfiler::Timer profile_timer);
+
   // Handle a known command or reply "unknown command"
 
   switch (parser.command_letter) {
 
-    case 'G': switch (parser.codenum) {
-
-      case 0: case 1:                                             // G0: Fast Move, G1: Linear Move
-        G0_G1(TERN_(HAS_FAST_MOVES, parser.codenum == 0)); break;
-
-      #if ENABLED(ARC_SUPPORT)
-        case 2: case 3: G2_G3(parser.codenum == 2); break;        // G2: CW ARC, G3: CCW ARC
-      #endif
+    case 'G': {
+      // G-code handlers, sorted by code
+      static constexpr handler_entry_t g_handlers[] PROGMEM = {
+        { 0, G0 },                                                // G0: Fast Move
+        { 1, G1 },                                                // G1: Linear Move
 
-      case 4: G4(); break;                                        // G4: Dwell
+        #if ENABLED(ARC_SUPPORT)
+          { 2, G2 },                                              // G2: CW ARC
+          { 3, G3 },                                              // G3: CCW ARC
+        #endif
 
-      #if ENABLED(BEZIER_CURVE_SUPPORT)
-        case 5: G5(); break;                                      // G5: Cubic B_spline
-      #endif
+        { 4, G4 },                                                // G4: Dwell
 
-      #if ENABLED(DIRECT_STEPPING)
-        case 6: G6(); break;                                      // G6: Direct Stepper Move
-      #endif
+        #if ENABLED(BEZIER_CURVE_SUPPORT)
+          { 5, G5 },                                              // G5: Cubic B_spline
+        #endif
 
-      #if ENABLED(FWRETRACT)
-        case 10: G10(); break;                                    // G10: Retract / Swap Retract
-        case 11: G11(); break;                                    // G11: Recover / Swap Recover
-      #endif
+        #if ENABLED(DIRECT_STEPPING)
+          { 6, G6 },                                              // G6: Direct Stepper Move
+        #endif
 
-      #if ENABLED(NOZZLE_CLEAN_FEATURE)
-        case 12: G12(); break;                                    // G12: Nozzle Clean
-      #endif
+        #if ENABLED(FWRETRACT)
+          { 10, G10 },                                            // G10: Retract / Swap Retract
+          { 11, G11 },                                            // G11: Recover / Swap Recover
+        #endif
 
-      #if ENABLED(CNC_WORKSPACE_PLANES)
-        case 17: G17(); break;                                    // G17: Select Plane XY
-        case 18: G18(); break;                                    // G18: Select Plane ZX
-        case 19: G19(); break;                                    // G19: Select Plane YZ
-      #endif
+        #if ENABLED(NOZZLE_CLEAN_FEATURE)
+          { 12, G12 },                                            // G12: Nozzle Clean
+        #endif
 
-      #if ENABLED(INCH_MODE_SUPPORT)
-        case 20: G20(); break;                                    // G20: Inch Mode
-        case 21: G21(); break;                                    // G21: MM Mode
-      #else
-        case 21: NOOP; break;                                     // No error on unknown G21
-      #endif
+        #if ENABLED(CNC_WORKSPACE_PLANES)
+          { 17, G17 },                                            // G17: Select Plane XY
+          { 18, G18 },                                            // G18: Select Plane ZX
+          { 19, G19 },                                            // G19: Select Plane YZ
+        #endif
 
-      #if ENABLED(G26_MESH_VALIDATION)
-        case 26: G26(); break;                                    // G26: Mesh Validation Pattern generation
-      #endif
+        #if ENABLED(INCH_MODE_SUPPORT)
+          { 20, G20 },                                            // G20: Inch Mode
+          { 21, G21 },                                            // G21: MM Mode
+        #else
+          { 21, nullptr },                                        // No error on unknown G21
+        #endif
 
-      #if ENABLED(NOZZLE_PARK_FEATURE)
-        case 27: G27(); break;                                    // G27: Nozzle Park
-      #endif
+        #if ENABLED(G26_MESH_VALIDATION)
+          { 26, G26 },                                            // G26: Mesh Validation Pattern generation
+        #endif
 
-      case 28: G28(); break;                                      // G28: Home one or more axes
+        #if ENABLED(NOZZLE_PARK_FEATURE)
+          { 27, G27 },                                            // G27: Nozzle Park
+        #endif
 
-      #if HAS_LEVELING
-        case 29:                                                  // G29: Bed leveling calibration
-          TERN(G29_RETRY_AND_RECOVER, G29_with_retry, G29)();
-          break;
-      #endif
+        { 28, G28 },                                              // G28: Home one or more axes
 
-      #if HAS_BED_PROBE
-        case 30: G30(); break;                                    // G30: Single Z probe
-        #if ENABLED(Z_PROBE_SLED)
-          case 31: G31(); break;                                  // G31: dock the sled
-          case 32: G32(); break;                                  // G32: undock the sled
+        #if HAS_LEVELING
+          { 29, TERN(G29_RETRY_AND_RECOVER, G29_with_retry, G29) }, // G29: Bed leveling calibration
         #endif
-      #endif
 
-      #if ENABLED(DELTA_AUTO_CALIBRATION)
-        case 33: G33(); break;                                    // G33: Delta Auto-Calibration
-      #endif
-
-      #if ANY(Z_MULTI_ENDSTOPS, Z_STEPPER_AUTO_ALIGN, MECHANICAL_GANTRY_CALIBRATION)
-        case 34: G34(); break;                                    // G34: Z Stepper automatic alignment using probe
-      #endif
+        #if HAS_BED_PROBE
+          { 30, G30 },                                            // G30: Single Z probe
+          #if ENABLED(Z_PROBE_SLED)
+            { 31, G31 },                                          // G31: dock the sled
+            { 32, G32 },                                          // G32: undock the sled
+          #endif
+        #endif
 
-      #if ENABLED(ASSISTED_TRAMMING)
-        case 35: G35(); break;                                    // G35: Read four bed corners to help adjust bed screws
-      #endif
+        #if ENABLED(DELTA_AUTO_CALIBRATION)
+          { 33, G33 },                                            // G33: Delta Auto-Calibration
+        #endif
 
-      #if ENABLED(G38_PROBE_TARGET)
-        case 38:                                                  // G38.2, G38.3: Probe towards target
-          if (WITHIN(parser.subcode, 2, TERN(G38_PROBE_AWAY, 5, 3)))
-            G38(parser.subcode);                                  // G38.4, G38.5: Probe away from target
-          break;
-      #endif
+        #if ANY(Z_MULTI_ENDSTOPS, Z_STEPPER_AUTO_ALIGN, MECHANICAL_GANTRY_CALIBRATION)
+          { 34, G34 },                                            // G34: Z Stepper automatic alignment using probe
+        #endif
 
-      #if HAS_MESH
-        case 42: G42(); break;                                    // G42: Coordinated move to a mesh point
-      #endif
+        #if ENABLED(ASSISTED_TRAMMING)
+          { 35, G35 },                                            // G35: Read four bed corners to help adjust bed screws
+        #endif
 
-      #if ENABLED(CNC_COORDINATE_SYSTEMS)
-        case 53: G53(); break;                                    // G53: (prefix) Apply native workspace
-        case 54: G54(); break;                                    // G54: Switch to Workspace 1
-        case 55: G55(); break;                                    // G55: Switch to Workspace 2
-        case 56: G56(); break;                                    // G56: Switch to Workspace 3
-        case 57: G57(); break;                                    // G57: Switch to Workspace 4
-        case 58: G58(); break;                                    // G58: Switch to Workspace 5
-        case 59: G59(); break;                                    // G59.0 - G59.3: Switch to Workspace 6-9
-      #endif
+        #if ENABLED(G38_PROBE_TARGET)
+          { 38, G38 },                                            // G38.2-G38.5: Probe towards or away from target
+        #endif
 
-      #if SAVED_POSITIONS
-        case 60: G60(); break;                                    // G60:  save current position
-        case 61: G61(); break;                                    // G61:  Apply/restore saved coordinates.
-      #endif
+        #if HAS_MESH
+          { 42, G42 },                                            // G42: Coordinated move to a mesh point
+        #endif
 
-      #if ALL(PTC_PROBE, PTC_BED)
-        case 76: G76(); break;                                    // G76: Calibrate first layer compensation values
-      #endif
+        #if ENABLED(CNC_COORDINATE_SYSTEMS)
+          { 53, G53 },                                            // G53: (prefix) Apply native workspace
+          { 54, G54 },                                            // G54: Switch to Workspace 1
+          { 55, G55 },                                            // G55: Switch to Workspace 2
+          { 56, G56 },                                            // G56: Switch to Workspace 3
+          { 57, G57 },                                            // G57: Switch to Workspace 4
+          { 58, G58 },                                            // G58: Switch to Workspace 5
+          { 59, G59 },                                            // G59.0 - G59.3: Switch to Workspace 6-9
+        #endif
 
-      #if ENABLED(GCODE_MOTION_MODES)
-        case 80: G80(); break;                                    // G80: Reset the current motion mode
-      #endif
+        #if SAVED_POSITIONS
+          { 60, G60 },                                            // G60:  save current position
+          { 61, G61 },                                            // G61:  Apply/restore saved coordinates.
+        #endif
 
-      case 90: set_relative_mode(false); break;                   // G90: Absolute Mode
-      case 91: set_relative_mode(true);  break;                   // G91: Relative Mode
+        #if ALL(PTC_PROBE, PTC_BED)
+          { 76, G76 },                                            // G76: Calibrate first layer compensation values
+        #endif
 
-      case 92: G92(); break;                                      // G92: Set current axis position(s)
+        #if ENABLED(GCODE_MOTION_MODES)
+          { 80, G80 },                                            // G80: Reset the current motion mode
+        #endif
 
-      #if ENABLED(CALIBRATION_GCODE)
-        case 425: G425(); break;                                  // G425: Perform calibration with calibration cube
-      #endif
+        { 90, G90 },                                              // G90: Absolute Mode
+        { 91, G91 },                                              // G91: Relative Mode
+        { 92, G92 },                                              // G92: Set current axis position(s)
 
-      #if ENABLED(DEBUG_GCODE_PARSER)
-        case 800: parser.debug(); break;                          // G800: G-Code Parser Test for G
-      #endif
+        #if ENABLED(CALIBRATION_GCODE)
+          { 425, G425 },                                          // G425: Perform calibration with calibration cube
+        #endif
 
-      default: parser.unknown_command_warning(); break;
+        #if ENABLED(DEBUG_GCODE_PARSER)
+          { 800, GCodeParser::debug },                            // G800: G-Code Parser Test for G
+        #endif
+      };
+      static_assert(handlers_sorted(g_handlers, COUNT(g_handlers)), "G-code handlers must be sorted by code.");
+      if (!dispatch(g_handlers, COUNT(g_handlers))) parser.unknown_command_warning();
     }
     break;
 
     case 'M': switch (parser.codenum) {
 
-      #if HAS_RESUME_CONTINUE
-        case 0:                                                   // M0: Unconditional stop - Wait for user button press on LCD
-        case 1: M0_M1(); break;                                   // M1: Conditional stop - Wait for user button press on LCD
-      #endif
+      // Commands that send their own "ok" or none at all
 
-      #if HAS_CUTTER
-        case 3: M3_M4(false); break;                              // M3: Turn ON Laser | Spindle (clockwise), set Power | Speed
-        case 4: M3_M4(true ); break;                              // M4: Turn ON Laser | Spindle (counter-clockwise), set Power | Speed
-        case 5: M5(); break;                                      // M5: Turn OFF Laser | Spindle
-      #endif
+      case 105: M105(); return;                                   // M105: Report Temperatures (and say "ok")
 
-      #if ENABLED(COOLANT_MIST)
-        case 7: M7(); break;                                      // M7: Coolant Mist ON
+      #if ENABLED(MORGAN_SCARA)
+        case 360: if (M360()) return; break;                      // M360: SCARA Theta pos1
+        case 361: if (M361()) return; break;                      // M361: SCARA Theta pos2
+        case 362: if (M362()) return; break;                      // M362: SCARA Psi pos1
+        case 363: if (M363()) return; break;                      // M363: SCARA Psi pos2
+        case 364: if (M364()) return; break;                      // M364: SCARA Psi pos3 (90 deg to Theta)
       #endif
 
-      #if ANY(AIR_ASSIST, COOLANT_FLOOD)
-        case 8: M8(); break;                                      // M8: Air Assist / Coolant Flood ON
-      #endif
+      default: {
+        // M-code handlers, sorted by code
+        static constexpr handler_entry_t m_handlers[] PROGMEM = {
+          #if HAS_RESUME_CONTINUE
+            { 0, M0_M1 },                                         // M0: Unconditional stop - Wait for user button press on LCD
+            { 1, M0_M1 },                                         // M1: Conditional stop - Wait for user button press on LCD
+          #endif
 
-      #if ANY(AIR_ASSIST, COOLANT_CONTROL)
-        case 9: M9(); break;                                      // M9: Air Assist / Coolant OFF
-      #endif
+          #if HAS_CUTTER
+            { 3, M3 },                                            // M3: Turn ON Laser | Spindle (clockwise), set Power | Speed
+            { 4, M4 },                                            // M4: Turn ON Laser | Spindle (counter-clockwise), set Power | Speed
+            { 5, M5 },                                            // M5: Turn OFF Laser | Spindle
+          #endif
 
-      #if ENABLED(AIR_EVACUATION)
-        case 10: M10(); break;                                    // M10: Vacuum or Blower motor ON
-        case 11: M11(); break;                                    // M11: Vacuum or Blower motor OFF
-      #endif
+          #if ENABLED(COOLANT_MIST)
+            { 7, M7 },                                            // M7: Coolant Mist ON
+          #endif
 
-      #if ENABLED(EXTERNAL_CLOSED_LOOP_CONTROLLER)
-        case 12: M12(); break;                                    // M12: Synchronize and optionally force a CLC set
-      #endif
+          #if ANY(AIR_ASSIST, COOLANT_FLOOD)
+            { 8, M8 },                                            // M8: Air Assist / Coolant Flood ON
+          #endif
 
-      #if ENABLED(EXPECTED_PRINTER_CHECK)
-        case 16: M16(); break;                                    // M16: Expected printer check
-      #endif
+          #if ANY(AIR_ASSIST, COOLANT_CONTROL)
+            { 9, M9 },                                            // M9: Air Assist / Coolant OFF
+          #endif
 
-      case 17: M17(); break;                                      // M17: Enable all stepper motors
-
-      #if HAS_MEDIA
-        case 20: M20(); break;                                    // M20: List SD card
-        case 21: M21(); break;                                    // M21: Init SD card
-        case 22: M22(); break;                                    // M22: Release SD card
-        case 23: M23(); break;                                    // M23: Select file
-        case 24: M24(); break;                                    // M24: Start SD print
-        case 25: M25(); break;                                    // M25: Pause SD print
-        case 26: M26(); break;                                    // M26: Set SD index
-        case 27: M27(); break;                                    // M27: Get SD status
-        case 28: M28(); break;                                    // M28: Start SD write
-        case 29: M29(); break;                                    // M29: Stop SD write
-        case 30: M30(); break;                                    // M30 <filename> Delete File
-
-        #if HAS_MEDIA_SUBCALLS
-          case 32: M32(); break;                                  // M32: Select file and start SD print
-        #endif
+          #if ENABLED(AIR_EVACUATION)
+            { 10, M10 },                                          // M10: Vacuum or Blower motor ON
+            { 11, M11 },                                          // M11: Vacuum or Blower motor OFF
+          #endif
 
-        #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
-          case 33: M33(); break;                                  // M33: Get the long full path to a file or folder
-        #endif
+          #if ENABLED(EXTERNAL_CLOSED_LOOP_CONTROLLER)
+            { 12, M12 },                                          // M12: Synchronize and optionally force a CLC set
+          #endif
 
-        #if ALL(SDCARD_SORT_ALPHA, SDSORT_GCODE)
-          case 34: M34(); break;                                  // M34: Set SD card sorting options
-        #endif
+          #if ENABLED(EXPECTED_PRINTER_CHECK)
+            { 16, M16 },                                          // M16: Expected printer check
+          #endif
 
-        case 928: M928(); break;                                  // M928: Start SD write
-      #endif // HAS_MEDIA
+          { 17, M17 },                                            // M17: Enable all stepper motors
+          { 18, M18_M84 },                                        // M18: Disable Steppers
+
+          #if HAS_MEDIA
+            { 20, M20 },                                          // M20: List SD card
+            { 21, M21 },                                          // M21: Init SD card
+            { 22, M22 },                                          // M22: Release SD card
+            { 23, M23 },                                          // M23: Select file
+            { 24, M24 },                                          // M24: Start SD print
+            { 25, M25 },                                          // M25: Pause SD print
+            { 26, M26 },                                          // M26: Set SD index
+            { 27, M27 },                                          // M27: Get SD status
+            { 28, M28 },                                          // M28: Start SD write
+            { 29, M29 },                                          // M29: Stop SD write
+            { 30, M30 },                                          // M30 <filename> Delete File
+          #endif
 
-      case 31: M31(); break;                                      // M31: Report time since the start of SD print or last M109
+          { 31, M31 },                                            // M31: Report time since the start of SD print or last M109
+
+          #if HAS_MEDIA
+            #if HAS_MEDIA_SUBCALLS
+              { 32, M32 },                                        // M32: Select file and start SD print
+            #endif
+            #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
+              { 33, M33 },                                        // M33: Get the long full path to a file or folder
+            #endif
+            #if ALL(SDCARD_SORT_ALPHA, SDSORT_GCODE)
+              { 34, M34 },                                        // M34: Set SD card sorting options
+            #endif
+          #endif
 
-      #if ENABLED(DIRECT_PIN_CONTROL)
-        case 42: M42(); break;                                    // M42: Change pin state
-      #endif
+          #if ENABLED(DIRECT_PIN_CONTROL)
+            { 42, M42 },                                          // M42: Change pin state
+          #endif
 
-      #if ENABLED(PINS_DEBUGGING)
-        case 43: M43(); break;                                    // M43: Read pin state
-      #endif
+          #if ENABLED(PINS_DEBUGGING)
+            { 43, M43 },                                          // M43: Read pin state
+          #endif
 
-      #if ENABLED(Z_MIN_PROBE_REPEATABILITY_TEST)
-        case 48: M48(); break;                                    // M48: Z probe repeatability test
-      #endif
+          #if ENABLED(Z_MIN_PROBE_REPEATABILITY_TEST)
+            { 48, M48 },                                          // M48: Z probe repeatability test
+          #endif
 
-      #if ENABLED(SET_PROGRESS_MANUALLY)
-        case 73: M73(); break;                                    // M73: Set progress percentage
-      #endif
+          #if ENABLED(SET_PROGRESS_MANUALLY)
+            { 73, M73 },                                          // M73: Set progress percentage
+          #endif
 
-      case 75: M75(); break;                                      // M75: Start print timer
-      case 76: M76(); break;                                      // M76: Pause print timer
-      case 77: M77(); break;                                      // M77: Stop print timer
+          { 75, M75 },                                            // M75: Start print timer
+          { 76, M76 },                                            // M76: Pause print timer
+          { 77, M77 },                                            // M77: Stop print timer
 
-      #if ENABLED(PRINTCOUNTER)
-        case 78: M78(); break;                                    // M78: Show print statistics
-      #endif
+          #if ENABLED(PRINTCOUNTER)
+            { 78, M78 },                                          // M78: Show print statistics
+          #endif
 
-      #if ENABLED(M100_FREE_MEMORY_WATCHER)
-        case 100: M100(); break;                                  // M100: Free Memory Report
-      #endif
+          #if ENABLED(PSU_CONTROL)
+            { 80, M80 },                                          // M80: Turn on Power Supply
+          #endif
 
-      #if ENABLED(BD_SENSOR)
-        case 102: M102(); break;                                  // M102: Configure Bed Distance Sensor
-      #endif
+          { 81, M81 },                                            // M81: Turn off Power, including Power Supply, if possible
 
-      #if HAS_HOTEND
-        case 104: M104(); break;                                  // M104: Set hot end temperature
-        case 109: M109(); break;                                  // M109: Wait for hotend temperature to reach target
-      #endif
+          #if HAS_EXTRUDERS
+            { 82, M82 },                                          // M82: Set E axis normal mode (same as other axes)
+            { 83, M83 },                                          // M83: Set E axis relative mode
+          #endif
 
-      case 105: M105(); return;                                   // M105: Report Temperatures (and say "ok")
+          { 84, M18_M84 },                                        // M84: Disable Steppers / Set Timeout
+          { 85, M85 },                                            // M85: Set inactivity stepper shutdown timeout
 
-      #if HAS_FAN
-        case 106: M106(); break;                                  // M106: Fan On
-        case 107: M107(); break;                                  // M107: Fan Off
-      #endif
+          #if ENABLED(HOTEND_IDLE_TIMEOUT)
+            { 86, M86 },                                          // M86: Set Hotend Idle Timeout
+            { 87, M87 },                                          // M87: Cancel Hotend Idle Timeout
+          #endif
 
-      case 110: M110(); break;                                    // M110: Set Current Line Number
-      case 111: M111(); break;                                    // M111: Set debug level
+          #if ENABLED(EDITABLE_STEPS_PER_UNIT)
+            { 92, M92 },                                          // M92: Set the steps-per-unit for one or more axes
+          #endif
 
-      #if DISABLED(EMERGENCY_PARSER)
-        case 108: M108(); break;                                  // M108: Cancel Waiting
-        case 112: M112(); break;                                  // M112: Full Shutdown
-        case 410: M410(); break;                                  // M410: Quickstop - Abort all the planned moves.
-        #if ENABLED(HOST_PROMPT_SUPPORT)
-          case 876: M876(); break;                                // M876: Handle Host prompt responses
-        #endif
-      #else
-        case 108: case 112: case 410:
-        TERN_(HOST_PROMPT_SUPPORT, case 876:)
-        break;
-      #endif
+          #if ENABLED(M100_FREE_MEMORY_WATCHER)
+            { 100, M100 },                                        // M100: Free Memory Report
+          #endif
 
-      #if ENABLED(HOST_KEEPALIVE_FEATURE)
-        case 113: M113(); break;                                  // M113: Set Host Keepalive interval
-      #endif
+          #if ENABLED(BD_SENSOR)
+            { 102, M102 },                                        // M102: Configure Bed Distance Sensor
+          #endif
 
-      #if HAS_FANCHECK
-        case 123: M123(); break;                                  // M123: Report fan states or set fans auto-report interval
-      #endif
+          #if HAS_HOTEND
+            { 104, M104 },                                        // M104: Set hot end temperature
+          #endif
 
-      #if HAS_HEATED_BED
-        case 140: M140(); break;                                  // M140: Set bed temperature
-        case 190: M190(); break;                                  // M190: Wait for bed temperature to reach target
-      #endif
+          #if HAS_FAN
+            { 106, M106 },                                        // M106: Fan On
+            { 107, M107 },                                        // M107: Fan Off
+          #endif
 
-      #if HAS_HEATED_CHAMBER
-        case 141: M141(); break;                                  // M141: Set chamber temperature
-        case 191: M191(); break;                                  // M191: Wait for chamber temperature to reach target
-      #endif
+          { 108, TERN(EMERGENCY_PARSER, nullptr, M108) },         // M108: Cancel Waiting
 
-      #if HAS_TEMP_PROBE
-        case 192: M192(); break;                                  // M192: Wait for probe temp
-      #endif
+          #if HAS_HOTEND
+            { 109, M109 },                                        // M109: Wait for hotend temperature to reach target
+          #endif
 
-      #if HAS_COOLER
-        case 143: M143(); break;                                  // M143: Set cooler temperature
-        case 193: M193(); break;                                  // M193: Wait for cooler temperature to reach target
-      #endif
+          { 110, M110 },                                          // M110: Set Current Line Number
+          { 111, M111 },                                          // M111: Set debug level
+          { 112, TERN(EMERGENCY_PARSER, nullptr, M112) },         // M112: Full Shutdown
 
-      #if ENABLED(AUTO_REPORT_POSITION)
-        case 154: M154(); break;                                  // M154: Set position auto-report interval
-      #endif
+          #if ENABLED(HOST_KEEPALIVE_FEATURE)
+            { 113, M113 },                                        // M113: Set Host Keepalive interval
+          #endif
 
-      #if ALL(AUTO_REPORT_TEMPERATURES, HAS_TEMP_SENSOR)
-        case 155: M155(); break;                                  // M155: Set temperature auto-report interval
-      #endif
+          { 114, M114 },                                          // M114: Report current position
 
-      #if ENABLED(PARK_HEAD_ON_PAUSE)
-        case 125: M125(); break;                                  // M125: Store current position and move to filament change position
-      #endif
+          #if ENABLED(CAPABILITIES_REPORT)
+            { 115, M115 },                                        // M115: Report capabilities
+          #endif
 
-      #if ENABLED(BARICUDA)
-        // PWM for HEATER_1_PIN
-        #if HAS_HEATER_1
-          case 126: M126(); break;                                // M126: valve open
-          case 127: M127(); break;                                // M127: valve closed
-        #endif
+          { 117, TERN(HAS_STATUS_MESSAGE, M117, nullptr) },       // M117: Set LCD message text, if possible
+          { 118, M118 },                                          // M118: Display a message in the host console
+          { 119, M119 },                                          // M119: Report endstop states
+          { 120, M120 },                                          // M120: Enable endstops
+          { 121, M121 },                                          // M121: Disable endstops
 
-        // PWM for HEATER_2_PIN
-        #if HAS_HEATER_2
-          case 128: M128(); break;                                // M128: valve open
-          case 129: M129(); break;                                // M129: valve closed
-        #endif
-      #endif // BARICUDA
+          #if HAS_TRINAMIC_CONFIG
+            { 122, M122 },                                        // M122: Report driver configuration and status
+          #endif
 
-      #if ENABLED(PSU_CONTROL)
-        case 80: M80(); break;                                    // M80: Turn on Power Supply
-      #endif
-      case 81: M81(); break;                                      // M81: Turn off Power, including Power Supply, if possible
+          #if HAS_FANCHECK
+            { 123, M123 },                                        // M123: Report fan states or set fans auto-report interval
+          #endif
 
-      #if HAS_EXTRUDERS
-        case 82: M82(); break;                                    // M82: Set E axis normal mode (same as other axes)
-        case 83: M83(); break;                                    // M83: Set E axis relative mode
-      #endif
+          #if ENABLED(PARK_HEAD_ON_PAUSE)
+            { 125, M125 },                                        // M125: Store current position and move to filament change position
+          #endif
 
-      case 18: case 84: M18_M84(); break;                         // M18/M84: Disable Steppers / Set Timeout
-      case 85: M85(); break;                                      // M85: Set inactivity stepper shutdown timeout
+          #if ENABLED(BARICUDA)
+            #if HAS_HEATER_1
+              { 126, M126 },                                      // M126: valve open
+              { 127, M127 },                                      // M127: valve closed
+            #endif
+            #if HAS_HEATER_2
+              { 128, M128 },                                      // M128: valve open
+              { 129, M129 },                                      // M129: valve closed
+            #endif
+          #endif
 
-      #if ENABLED(HOTEND_IDLE_TIMEOUT)
-        case 86: M86(); break;                                    // M86: Set Hotend Idle Timeout
-        case 87: M87(); break;                                    // M87: Cancel Hotend Idle Timeout
-      #endif
+          #if HAS_HEATED_BED
+            { 140, M140 },                                        // M140: Set bed temperature
+          #endif
 
-      #if ENABLED(EDITABLE_STEPS_PER_UNIT)
-        case 92: M92(); break;                                    // M92: Set the steps-per-unit for one or more axes
-      #endif
+          #if HAS_HEATED_CHAMBER
+            { 141, M141 },                                        // M141: Set chamber temperature
+          #endif
 
-      case 114: M114(); break;                                    // M114: Report current position
+          #if HAS_COOLER
+            { 143, M143 },                                        // M143: Set cooler temperature
+          #endif
 
-      #if ENABLED(CAPABILITIES_REPORT)
-        case 115: M115(); break;                                  // M115: Report capabilities
-      #endif
+          #if HAS_PREHEAT
+            { 145, M145 },                                        // M145: Set material heatup parameters
+          #endif
 
-      case 117: TERN_(HAS_STATUS_MESSAGE, M117()); break;         // M117: Set LCD message text, if possible
+          #if ENABLED(TEMPERATURE_UNITS_SUPPORT)
+            { 149, M149 },                                        // M149: Set temperature units
+          #endif
 
-      case 118: M118(); break;                                    // M118: Display a message in the host console
-      case 119: M119(); break;                                    // M119: Report endstop states
-      case 120: M120(); break;                                    // M120: Enable endstops
-      case 121: M121(); break;                                    // M121: Disable endstops
+          #if HAS_COLOR_LEDS
+            { 150, M150 },                                        // M150: Set Status LED Color
+          #endif
 
-      #if HAS_PREHEAT
-        case 145: M145(); break;                                  // M145: Set material heatup parameters
-      #endif
+          #if ENABLED(AUTO_REPORT_PLANNER_STATS)
+            { 153, M153 },                                        // M153: Report planner statistics or set the auto-report interval
+          #endif
 
-      #if ENABLED(TEMPERATURE_UNITS_SUPPORT)
-        case 149: M149(); break;                                  // M149: Set temperature units
-      #endif
+          #if ENABLED(AUTO_REPORT_POSITION)
+            { 154, M154 },                                        // M154: Set position auto-report interval
+          #endif
 
-      #if HAS_COLOR_LEDS
-        case 150: M150(); break;                                  // M150: Set Status LED Color
-      #endif
+          #if ALL(AUTO_REPORT_TEMPERATURES, HAS_TEMP_SENSOR)
+            { 155, M155 },                                        // M155: Set temperature auto-report interval
+          #endif
 
-      #if ENABLED(MIXING_EXTRUDER)
-        case 163: M163(); break;                                  // M163: Set a component weight for mixing extruder
-        case 164: M164(); break;                                  // M164: Save current mix as a virtual extruder
-        #if ENABLED(DIRECT_MIXING_IN_G1)
-          case 165: M165(); break;                                // M165: Set multiple mix weights
-        #endif
-        #if ENABLED(GRADIENT_MIX)
-          case 166: M166(); break;                                // M166: Set Gradient Mix
-        #endif
-      #endif
+          #if ENABLED(GCODE_PROFILER)
+            { 156, M156 },                                        // M156: Report G-code handler call counts and times
+          #endif
 
-      #if DISABLED(NO_VOLUMETRICS)
-        case 200: M200(); break;                                  // M200: Set filament diameter, E to cubic units
-      #endif
+          #if ENABLED(MIXING_EXTRUDER)
+            { 163, M163 },                                        // M163: Set a component weight for mixing extruder
+            { 164, M164 },                                        // M164: Save current mix as a virtual extruder
+            #if ENABLED(DIRECT_MIXING_IN_G1)
+              { 165, M165 },                                      // M165: Set multiple mix weights
+            #endif
+            #if ENABLED(GRADIENT_MIX)
+              { 166, M166 },                                      // M166: Set Gradient Mix
+            #endif
+          #endif
 
-      case 201: M201(); break;                                    // M201: Set max acceleration for print moves (units/s^2)
+          #if HAS_HEATED_BED
+            { 190, M190 },                                        // M190: Wait for bed temperature to reach target
+          #endif
 
-      #if 0
-        case 202: M202(); break;                                  // M202: Not used for Sprinter/grbl gen6
-      #endif
+          #if HAS_HEATED_CHAMBER
+            { 191, M191 },                                        // M191: Wait for chamber temperature to reach target
+          #endif
 
-      case 203: M203(); break;                                    // M203: Set max feedrate (units/sec)
-      case 204: M204(); break;                                    // M204: Set acceleration
-      case 205: M205(); break;                                    // M205: Set advanced settings
+          #if HAS_TEMP_PROBE
+            { 192, M192 },                                        // M192: Wait for probe temp
+          #endif
 
-      #if HAS_HOME_OFFSET
-        case 206: M206(); break;                                  // M206: Set home offsets
-      #endif
+          #if HAS_COOLER
+            { 193, M193 },                                        // M193: Wait for cooler temperature to reach target
+          #endif
 
-      #if ENABLED(FWRETRACT)
-        case 207: M207(); break;                                  // M207: Set Retract Length, Feedrate, and Z lift
-        case 208: M208(); break;                                  // M208: Set Recover (unretract) Additional Length and Feedrate
-        #if ENABLED(FWRETRACT_AUTORETRACT)
-          case 209:
-            if (MIN_AUTORETRACT <= MAX_AUTORETRACT) M209();       // M209: Turn Automatic Retract Detection on/off
-            break;
-        #endif
-      #endif
+          #if DISABLED(NO_VOLUMETRICS)
+            { 200, M200 },                                        // M200: Set filament diameter, E to cubic units
+          #endif
 
-      #if ENABLED(EDITABLE_HOMING_FEEDRATE)
-        case 210: M210(); break;                                  // M210: Set the homing feedrate
-      #endif
+          { 201, M201 },                                          // M201: Set max acceleration for print moves (units/s^2)
 
-      #if HAS_SOFTWARE_ENDSTOPS
-        case 211: M211(); break;                                  // M211: Enable, Disable, and/or Report software endstops
-      #endif
+          #if 0
+            { 202, M202 },                                        // M202: Not used for Sprinter/grbl gen6
+          #endif
 
-      #if HAS_MULTI_EXTRUDER
-        case 217: M217(); break;                                  // M217: Set filament swap parameters
-      #endif
+          { 203, M203 },                                          // M203: Set max feedrate (units/sec)
+          { 204, M204 },                                          // M204: Set acceleration
+          { 205, M205 },                                          // M205: Set advanced settings
 
-      #if HAS_HOTEND_OFFSET
-        case 218: M218(); break;                                  // M218: Set a tool offset
-      #endif
+          #if HAS_HOME_OFFSET
+            { 206, M206 },                                        // M206: Set home offsets
+          #endif
 
-      case 220: M220(); break;                                    // M220: Set Feedrate Percentage: S<percent> ("FR" on your LCD)
+          #if ENABLED(FWRETRACT)
+            { 207, M207 },                                        // M207: Set Retract Length, Feedrate, and Z lift
+            { 208, M208 },                                        // M208: Set Recover (unretract) Additional Length and Feedrate
+            #if ENABLED(FWRETRACT_AUTORETRACT)
+              { 209, MIN_AUTORETRACT <= MAX_AUTORETRACT ? M209 : nullptr }, // M209: Turn Automatic Retract Detection on/off
+            #endif
+          #endif
 
-      #if HAS_EXTRUDERS
-        case 221: M221(); break;                                  // M221: Set Flow Percentage
-      #endif
+          #if ENABLED(EDITABLE_HOMING_FEEDRATE)
+            { 210, M210 },                                        // M210: Set the homing feedrate
+          #endif
 
-      #if ENABLED(DIRECT_PIN_CONTROL)
-        case 226: M226(); break;                                  // M226: Wait until a pin reaches a state
-      #endif
+          #if HAS_SOFTWARE_ENDSTOPS
+            { 211, M211 },                                        // M211: Enable, Disable, and/or Report software endstops
+          #endif
 
-      #if HAS_SERVOS
-        case 280: M280(); break;                                  // M280: Set servo position absolute
-        #if ENABLED(EDITABLE_SERVO_ANGLES)
-          case 281: M281(); break;                                // M281: Set servo angles
-        #endif
-        #if ENABLED(SERVO_DETACH_GCODE)
-          case 282: M282(); break;                                // M282: Detach servo
-        #endif
-      #endif
+          #if HAS_MULTI_EXTRUDER
+            { 217, M217 },                                        // M217: Set filament swap parameters
+          #endif
 
-      #if ENABLED(BABYSTEPPING)
-        case 290: M290(); break;                                  // M290: Babystepping
-        #if ENABLED(EP_BABYSTEPPING)
-          case 293: IF_DISABLED(EMERGENCY_PARSER, M293()); break; // M293: Babystep up
-          case 294: IF_DISABLED(EMERGENCY_PARSER, M294()); break; // M294: Babystep down
-        #endif
-      #endif
+          #if HAS_HOTEND_OFFSET
+            { 218, M218 },                                        // M218: Set a tool offset
+          #endif
 
-      #if HAS_SOUND
-        case 300: M300(); break;                                  // M300: Play beep tone
-      #endif
+          { 220, M220 },                                          // M220: Set Feedrate Percentage: S<percent> ("FR" on your LCD)
 
-      #if ENABLED(PIDTEMP)
-        case 301: M301(); break;                                  // M301: Set hotend PID parameters
-      #endif
+          #if HAS_EXTRUDERS
+            { 221, M221 },                                        // M221: Set Flow Percentage
+          #endif
 
-      #if ENABLED(PIDTEMPBED)
-        case 304: M304(); break;                                  // M304: Set bed PID parameters
-      #endif
+          #if ENABLED(DIRECT_PIN_CONTROL)
+            { 226, M226 },                                        // M226: Wait until a pin reaches a state
+          #endif
 
-      #if ENABLED(PIDTEMPCHAMBER)
-        case 309: M309(); break;                                  // M309: Set chamber PID parameters
-      #endif
+          #if ENABLED(PHOTO_GCODE)
+            { 240, M240 },                                        // M240: Trigger a camera
+          #endif
 
-      #if ENABLED(PHOTO_GCODE)
-        case 240: M240(); break;                                  // M240: Trigger a camera
-      #endif
+          #if HAS_LCD_CONTRAST
+            { 250, M250 },                                        // M250: Set LCD contrast
+          #endif
 
-      #if HAS_LCD_CONTRAST
-        case 250: M250(); break;                                  // M250: Set LCD contrast
-      #endif
+          #if ENABLED(EDITABLE_DISPLAY_TIMEOUT)
+            { 255, M255 },                                        // M255: Set LCD Sleep/Backlight Timeout (Minutes)
+          #endif
 
-      #if ENABLED(EDITABLE_DISPLAY_TIMEOUT)
-        case 255: M255(); break;                                  // M255: Set LCD Sleep/Backlight Timeout (Minutes)
-      #endif
+          #if HAS_LCD_BRIGHTNESS
+            { 256, M256 },                                        // M256: Set LCD brightness
+          #endif
 
-      #if HAS_LCD_BRIGHTNESS
-        case 256: M256(); break;                                  // M256: Set LCD brightness
-      #endif
+          #if ENABLED(EXPERIMENTAL_I2CBUS)
+            { 260, M260 },                                        // M260: Send data to an i2c slave
+            { 261, M261 },                                        // M261: Request data from an i2c slave
+          #endif
 
-      #if ENABLED(EXPERIMENTAL_I2CBUS)
-        case 260: M260(); break;                                  // M260: Send data to an i2c slave
-        case 261: M261(); break;                                  // M261: Request data from an i2c slave
-      #endif
+          #if HAS_SERVOS
+            { 280, M280 },                                        // M280: Set servo position absolute
+            #if ENABLED(EDITABLE_SERVO_ANGLES)
+              { 281, M281 },                                      // M281: Set servo angles
+            #endif
+            #if ENABLED(SERVO_DETACH_GCODE)
+              { 282, M282 },                                      // M282: Detach servo
+            #endif
+          #endif
 
-      #if ENABLED(PREVENT_COLD_EXTRUSION)
-        case 302: M302(); break;                                  // M302: Allow cold extrudes (set the minimum extrude temperature)
-      #endif
+          #if ENABLED(BABYSTEPPING)
+            { 290, M290 },                                        // M290: Babystepping
+            #if ENABLED(EP_BABYSTEPPING)
+              { 293, TERN(EMERGENCY_PARSER, nullptr, M293) },     // M293: Babystep up
+              { 294, TERN(EMERGENCY_PARSER, nullptr, M294) },     // M294: Babystep down
+            #endif
+          #endif
 
-      #if HAS_PID_HEATING
-        case 303: M303(); break;                                  // M303: PID autotune
-      #endif
+          #if HAS_SOUND
+            { 300, M300 },                                        // M300: Play beep tone
+          #endif
 
-      #if HAS_USER_THERMISTORS
-        case 305: M305(); break;                                  // M305: Set user thermistor parameters
-      #endif
+          #if ENABLED(PIDTEMP)
+            { 301, M301 },                                        // M301: Set hotend PID parameters
+          #endif
 
-      #if ENABLED(MPCTEMP)
-        case 306: M306(); break;                                  // M306: MPC autotune
-      #endif
+          #if ENABLED(PREVENT_COLD_EXTRUSION)
+            { 302, M302 },                                        // M302: Allow cold extrudes (set the minimum extrude temperature)
+          #endif
 
-      #if ENABLED(REPETIER_GCODE_M360)
-        case 360: M360(); break;                                  // M360: Firmware settings
-      #endif
+          #if HAS_PID_HEATING
+            { 303, M303 },                                        // M303: PID autotune
+          #endif
 
-      #if ENABLED(MORGAN_SCARA)
-        case 360: if (M360()) return; break;                      // M360: SCARA Theta pos1
-        case 361: if (M361()) return; break;                      // M361: SCARA Theta pos2
-        case 362: if (M362()) return; break;                      // M362: SCARA Psi pos1
-        case 363: if (M363()) return; break;                      // M363: SCARA Psi pos2
-        case 364: if (M364()) return; break;                      // M364: SCARA Psi pos3 (90 deg to Theta)
-      #endif
+          #if ENABLED(PIDTEMPBED)
+            { 304, M304 },                                        // M304: Set bed PID parameters
+          #endif
 
-      #if ANY(EXT_SOLENOID, MANUAL_SOLENOID_CONTROL)
-        case 380: M380(); break;                                  // M380: Activate solenoid on active (or specified) extruder
-        case 381: M381(); break;                                  // M381: Disable all solenoids or, if MANUAL_SOLENOID_CONTROL, active (or specified) solenoid
-      #endif
+          #if HAS_USER_THERMISTORS
+            { 305, M305 },                                        // M305: Set user thermistor parameters
+          #endif
 
-      case 400: M400(); break;                                    // M400: Finish all moves
+          #if ENABLED(MPCTEMP)
+            { 306, M306 },                                        // M306: MPC autotune
+          #endif
 
-      #if HAS_BED_PROBE
-        case 401: M401(); break;                                  // M401: Deploy probe
-        case 402: M402(); break;                                  // M402: Stow probe
-      #endif
+          #if ENABLED(PIDTEMPCHAMBER)
+            { 309, M309 },                                        // M309: Set chamber PID parameters
+          #endif
 
-      #if HAS_PRUSA_MMU2 || HAS_PRUSA_MMU3
-        case 403: M403(); break;
-      #endif
+          #if HAS_MICROSTEPS
+            { 350, M350 },                                        // M350: Set microstepping mode. Warning: Steps per unit remains unchanged. S code sets stepping mode for all drivers.
+            { 351, M351 },                                        // M351: Toggle MS1 MS2 pins directly, S# determines MS1 or MS2, X# sets the pin high/low.
+          #endif
 
-      #if ENABLED(FILAMENT_WIDTH_SENSOR)
-        case 404: M404(); break;                                  // M404: Enter the nominal filament width (3mm, 1.75mm ) N<3.0> or display nominal filament width
-        case 405: M405(); break;                                  // M405: Turn on filament sensor for control
-        case 406: M406(); break;                                  // M406: Turn off filament sensor for control
-        case 407: M407(); break;                                  // M407: Display measured filament diameter
-      #endif
+          #if ENABLED(CASE_LIGHT_ENABLE)
+            { 355, M355 },                                        // M355: Set case light brightness
+          #endif
 
-      #if HAS_FILAMENT_SENSOR
-        case 412: M412(); break;                                  // M412: Enable/Disable filament runout detection
-      #endif
+          #if ENABLED(REPETIER_GCODE_M360)
+            { 360, M360 },                                        // M360: Firmware settings
+          #endif
 
-      #if HAS_MULTI_LANGUAGE
-        case 414: M414(); break;                                  // M414: Select multi language menu
-      #endif
+          #if ANY(EXT_SOLENOID, MANUAL_SOLENOID_CONTROL)
+            { 380, M380 },                                        // M380: Activate solenoid on active (or specified) extruder
+            { 381, M381 },                                        // M381: Disable all solenoids or, if MANUAL_SOLENOID_CONTROL, active (or specified) solenoid
+          #endif
 
-      #if HAS_LEVELING
-        case 420: M420(); break;                                  // M420: Enable/Disable Bed Leveling
-      #endif
+          { 400, M400 },                                          // M400: Finish all moves
 
-      #if HAS_MESH
-        case 421: M421(); break;                                  // M421: Set a Mesh Bed Leveling Z coordinate
-      #endif
+          #if HAS_BED_PROBE
+            { 401, M401 },                                        // M401: Deploy probe
+            { 402, M402 },                                        // M402: Stow probe
+          #endif
 
-      #if ENABLED(X_AXIS_TWIST_COMPENSATION)
-        case 423: M423(); break;                                  // M423: Reset, modify, or report X-Twist Compensation data
-      #endif
+          #if HAS_PRUSA_MMU2 || HAS_PRUSA_MMU3
+            { 403, M403 },
+          #endif
 
-      #if ENABLED(BACKLASH_GCODE)
-        case 425: M425(); break;                                  // M425: Tune backlash compensation
-      #endif
+          #if ENABLED(FILAMENT_WIDTH_SENSOR)
+            { 404, M404 },                                        // M404: Enter the nominal filament width (3mm, 1.75mm ) N<3.0> or display nominal filament width
+            { 405, M405 },                                        // M405: Turn on filament sensor for control
+            { 406, M406 },                                        // M406: Turn off filament sensor for control
+            { 407, M407 },                                        // M407: Display measured filament diameter
+          #endif
 
-      #if HAS_HOME_OFFSET
-        case 428: M428(); break;                                  // M428: Apply current_position to home_offset
-      #endif
+          { 410, TERN(EMERGENCY_PARSER, nullptr, M410) },         // M410: Quickstop - Abort all the planned moves.
 
-      #if HAS_POWER_MONITOR
-        case 430: M430(); break;                                  // M430: Read the system current (A), voltage (V), and power (W)
-      #endif
+          #if HAS_FILAMENT_SENSOR
+            { 412, M412 },                                        // M412: Enable/Disable filament runout detection
+          #endif
 
-      #if HAS_RS485_SERIAL
-        case 485: M485(); break;                                  // M485: Send RS485 packets
-      #endif
+          #if ENABLED(POWER_LOSS_RECOVERY)
+            { 413, M413 },                                        // M413: Enable/disable/query Power-Loss Recovery
+          #endif
 
-      #if ENABLED(CANCEL_OBJECTS)
-        case 486: M486(); break;                                  // M486: Identify and cancel objects
-      #endif
+          #if HAS_MULTI_LANGUAGE
+            { 414, M414 },                                        // M414: Select multi language menu
+          #endif
 
-      #if ENABLED(FT_MOTION)
-        case 493: M493(); break;                                  // M493: Fixed-Time Motion control
-      #endif
+          #if HAS_LEVELING
+            { 420, M420 },                                        // M420: Enable/Disable Bed Leveling
+          #endif
 
-      case 500: M500(); break;                                    // M500: Store settings in EEPROM
-      case 501: M501(); break;                                    // M501: Read settings from EEPROM
-      case 502: M502(); break;                                    // M502: Revert to default settings
-      #if DISABLED(DISABLE_M503)
-        case 503: M503(); break;                                  // M503: print settings currently in memory
-      #endif
-      #if ENABLED(EEPROM_SETTINGS)
-        case 504: M504(); break;                                  // M504: Validate EEPROM contents
-      #endif
+          #if HAS_MESH
+            { 421, M421 },                                        // M421: Set a Mesh Bed Leveling Z coordinate
+          #endif
 
-      #if ENABLED(PASSWORD_FEATURE)
-        case 510: M510(); break;                                  // M510: Lock Printer
-        #if ENABLED(PASSWORD_UNLOCK_GCODE)
-          case 511: M511(); break;                                // M511: Unlock Printer
-        #endif
-        #if ENABLED(PASSWORD_CHANGE_GCODE)
-          case 512: M512(); break;                                // M512: Set/Change/Remove Password
-        #endif
-      #endif
+          #if ENABLED(Z_STEPPER_AUTO_ALIGN)
+            { 422, M422 },                                        // M422: Set Z Stepper automatic alignment position using probe
+          #endif
 
-      #if HAS_MEDIA
-        case 524: M524(); break;                                  // M524: Abort the current SD print job
-      #endif
+          #if ENABLED(X_AXIS_TWIST_COMPENSATION)
+            { 423, M423 },                                        // M423: Reset, modify, or report X-Twist Compensation data
+          #endif
 
-      #if ENABLED(SD_ABORT_ON_ENDSTOP_HIT)
-        case 540: M540(); break;                                  // M540: Set abort on endstop hit for SD printing
-      #endif
+          #if ENABLED(BACKLASH_GCODE)
+            { 425, M425 },                                        // M425: Tune backlash compensation
+          #endif
 
-      #if ENABLED(CONFIGURABLE_MACHINE_NAME)
-        case 550: M550(); break;                                  // M550: Set machine name
-      #endif
+          #if HAS_HOME_OFFSET
+            { 428, M428 },                                        // M428: Apply current_position to home_offset
+          #endif
 
-      #if HAS_ETHERNET
-        case 552: M552(); break;                                  // M552: Set IP address
-        case 553: M553(); break;                                  // M553: Set gateway
-        case 554: M554(); break;                                  // M554: Set netmask
-      #endif
+          #if HAS_POWER_MONITOR
+            { 430, M430 },                                        // M430: Read the system current (A), voltage (V), and power (W)
+          #endif
 
-      #if ENABLED(BAUD_RATE_GCODE)
-        case 575: M575(); break;                                  // M575: Set serial baudrate
-      #endif
+          #if HAS_RS485_SERIAL
+            { 485, M485 },                                        // M485: Send RS485 packets
+          #endif
 
-      #if ENABLED(NONLINEAR_EXTRUSION)
-        case 592: M592(); break;                                  // M592: Nonlinear Extrusion control
-      #endif
+          #if ENABLED(CANCEL_OBJECTS)
+            { 486, M486 },                                        // M486: Identify and cancel objects
+          #endif
 
-      #if HAS_ZV_SHAPING
-        case 593: M593(); break;                                  // M593: Input Shaping control
-      #endif
+          #if ENABLED(FT_MOTION)
+            { 493, M493 },                                        // M493: Fixed-Time Motion control
+          #endif
 
-      #if ENABLED(ADVANCED_PAUSE_FEATURE)
-        case 600: M600(); break;                                  // M600: Pause for Filament Change
-        #if ENABLED(CONFIGURE_FILAMENT_CHANGE)
-          case 603: M603(); break;                                  // M603: Configure Filament Change
-        #endif
-      #endif
+          { 500, M500 },                                          // M500: Store settings in EEPROM
+          { 501, M501 },                                          // M501: Read settings from EEPROM
+          { 502, M502 },                                          // M502: Revert to default settings
 
-      #if HAS_DUPLICATION_MODE
-        case 605: M605(); break;                                  // M605: Set Dual X Carriage movement mode
-      #endif
+          #if DISABLED(DISABLE_M503)
+            { 503, M503 },                                        // M503: print settings currently in memory
+          #endif
 
-      #if IS_KINEMATIC
-        case 665: M665(); break;                                  // M665: Set Kinematics parameters
-      #endif
+          #if ENABLED(EEPROM_SETTINGS)
+            { 504, M504 },                                        // M504: Validate EEPROM contents
+          #endif
 
-      #if ANY(DELTA, HAS_EXTRA_ENDSTOPS)
-        case 666: M666(); break;                                  // M666: Set delta or multiple endstop adjustment
-      #endif
+          #if ENABLED(PASSWORD_FEATURE)
+            { 510, M510 },                                        // M510: Lock Printer
+            #if ENABLED(PASSWORD_UNLOCK_GCODE)
+              { 511, M511 },                                      // M511: Unlock Printer
+            #endif
+            #if ENABLED(PASSWORD_CHANGE_GCODE)
+              { 512, M512 },                                      // M512: Set/Change/Remove Password
+            #endif
+          #endif
 
-      #if ENABLED(DUET_SMART_EFFECTOR) && PIN_EXISTS(SMART_EFFECTOR_MOD)
-        case 672: M672(); break;                                  // M672: Set/clear Duet Smart Effector sensitivity
-      #endif
+          #if HAS_MEDIA
+            { 524, M524 },                                        // M524: Abort the current SD print job
+          #endif
 
-      #if ENABLED(FILAMENT_LOAD_UNLOAD_GCODES)
-        case 701: M701(); break;                                  // M701: Load Filament
-        case 702: M702(); break;                                  // M702: Unload Filament
-      #endif
+          #if ENABLED(SD_ABORT_ON_ENDSTOP_HIT)
+            { 540, M540 },                                        // M540: Set abort on endstop hit for SD printing
+          #endif
 
-      #if HAS_PRUSA_MMU3
-        case 704: M704(); break;                                  // M704: Preload to MMU
-        case 705: M705(); break;                                  // M705: Eject filament
-        case 706: M706(); break;                                  // M706: Cut filament
-        case 707: M707(); break;                                  // M707: Read from MMU register
-        case 708: M708(); break;                                  // M708: Write to MMU register
-        case 709: M709(); break;                                  // M709: MMU power & reset
-      #endif
+          #if ENABLED(CONFIGURABLE_MACHINE_NAME)
+            { 550, M550 },                                        // M550: Set machine name
+          #endif
 
-      #if ENABLED(CONTROLLER_FAN_EDITABLE)
-        case 710: M710(); break;                                  // M710: Set Controller Fan settings
-      #endif
+          #if HAS_ETHERNET
+            { 552, M552 },                                        // M552: Set IP address
+            { 553, M553 },                                        // M553: Set gateway
+            { 554, M554 },                                        // M554: Set netmask
+          #endif
 
-      #if ENABLED(GCODE_MACROS)
-        case 810: case 811: case 812: case 813: case 814:
-        case 815: case 816: case 817: case 818: case 819:
-        M810_819(); break;                                        // M810-M819: Define/execute G-code macro
-        case 820: M820(); break;                                  // M820: Report macros to serial output
-      #endif
+          #if HAS_TRINAMIC_CONFIG
+            #if HAS_STEALTHCHOP
+              { 569, M569 },                                      // M569: Enable stealthChop on an axis.
+            #endif
+          #endif
 
-      #if HAS_BED_PROBE
-        case 851: M851(); break;                                  // M851: Set Z Probe Z Offset
-      #endif
+          #if ENABLED(BAUD_RATE_GCODE)
+            { 575, M575 },                                        // M575: Set serial baudrate
+          #endif
 
-      #if ENABLED(SKEW_CORRECTION_GCODE)
-        case 852: M852(); break;                                  // M852: Set Skew factors
-      #endif
+          #if ENABLED(SERIAL_ACK_WINDOW)
+            { 577, M577 },                                        // M577: Set lines acknowledged per "ok"
+          #endif
 
-      #if HAS_PTC
-        case 871: M871(); break;                                  // M871: Print/reset/clear first layer temperature offset values
-      #endif
+          #if ENABLED(NONLINEAR_EXTRUSION)
+            { 592, M592 },                                        // M592: Nonlinear Extrusion control
+          #endif
 
-      #if ENABLED(LIN_ADVANCE)
-        case 900: M900(); break;                                  // M900: Set advance K factor.
-      #endif
+          #if HAS_ZV_SHAPING
+            { 593, M593 },                                        // M593: Input Shaping control
+          #endif
 
-      #if ANY(HAS_MOTOR_CURRENT_SPI, HAS_MOTOR_CURRENT_PWM, HAS_MOTOR_CURRENT_I2C, HAS_MOTOR_CURRENT_DAC)
-        case 907: M907(); break;                                  // M907: Set digital trimpot motor current using axis codes.
-        #if ANY(HAS_MOTOR_CURRENT_SPI, HAS_MOTOR_CURRENT_DAC)
-          case 908: M908(); break;                                // M908: Control digital trimpot directly.
-          #if HAS_MOTOR_CURRENT_DAC
-            case 909: M909(); break;                              // M909: Print digipot/DAC current value
-            case 910: M910(); break;                              // M910: Commit digipot/DAC value to external EEPROM
+          #if ENABLED(ADVANCED_PAUSE_FEATURE)
+            { 600, M600 },                                        // M600: Pause for Filament Change
+            #if ENABLED(CONFIGURE_FILAMENT_CHANGE)
+              { 603, M603 },                                      // M603: Configure Filament Change
+            #endif
           #endif
-        #endif
-      #endif
 
-      #if HAS_TRINAMIC_CONFIG
-        case 122: M122(); break;                                  // M122: Report driver configuration and status
-        case 906: M906(); break;                                  // M906: Set motor current in milliamps using axis codes X, Y, Z, E
-        #if HAS_STEALTHCHOP
-          case 569: M569(); break;                                // M569: Enable stealthChop on an axis.
-        #endif
-        #if ENABLED(MONITOR_DRIVER_STATUS)
-          case 911: M911(); break;                                // M911: Report TMC2130 prewarn triggered flags
-          case 912: M912(); break;                                // M912: Clear TMC2130 prewarn triggered flags
-        #endif
-        #if ENABLED(HYBRID_THRESHOLD)
-          case 913: M913(); break;                                // M913: Set HYBRID_THRESHOLD speed
-        #endif
-        #if USE_SENSORLESS
-          case 914: M914(); break;                                // M914: Set StallGuard sensitivity
-        #endif
-        case 919: M919(); break;                                  // M919: Set stepper Chopper Times
-        #if ENABLED(EDITABLE_HOMING_CURRENT)
-          case 920: M920(); break;                                // M920: Set Homing Current
-        #endif
-      #endif
+          #if HAS_DUPLICATION_MODE
+            { 605, M605 },                                        // M605: Set Dual X Carriage movement mode
+          #endif
 
-      #if HAS_MICROSTEPS
-        case 350: M350(); break;                                  // M350: Set microstepping mode. Warning: Steps per unit remains unchanged. S code sets stepping mode for all drivers.
-        case 351: M351(); break;                                  // M351: Toggle MS1 MS2 pins directly, S# determines MS1 or MS2, X# sets the pin high/low.
-      #endif
+          #if IS_KINEMATIC
+            { 665, M665 },                                        // M665: Set Kinematics parameters
+          #endif
 
-      #if ENABLED(CASE_LIGHT_ENABLE)
-        case 355: M355(); break;                                  // M355: Set case light brightness
-      #endif
+          #if ANY(DELTA, HAS_EXTRA_ENDSTOPS)
+            { 666, M666 },                                        // M666: Set delta or multiple endstop adjustment
+          #endif
 
-      #if ENABLED(DEBUG_GCODE_PARSER)
-        case 800: parser.debug(); break;                          // M800: G-Code Parser Test for M
-      #endif
+          #if ENABLED(DUET_SMART_EFFECTOR) && PIN_EXISTS(SMART_EFFECTOR_MOD)
+            { 672, M672 },                                        // M672: Set/clear Duet Smart Effector sensitivity
+          #endif
 
-      #if ENABLED(GCODE_REPEAT_MARKERS)
-        case 808: M808(); break;                                  // M808: Set / Goto repeat markers
-      #endif
+          #if ENABLED(FILAMENT_LOAD_UNLOAD_GCODES)
+            { 701, M701 },                                        // M701: Load Filament
+            { 702, M702 },                                        // M702: Unload Filament
+          #endif
 
-      #if ENABLED(I2C_POSITION_ENCODERS)
-        case 860: M860(); break;                                  // M860: Report encoder module position
-        case 861: M861(); break;                                  // M861: Report encoder module status
-        case 862: M862(); break;                                  // M862: Perform axis test
-        case 863: M863(); break;                                  // M863: Calibrate steps/mm
-        case 864: M864(); break;                                  // M864: Change module address
-        case 865: M865(); break;                                  // M865: Check module firmware version
-        case 866: M866(); break;                                  // M866: Report axis error count
-        case 867: M867(); break;                                  // M867: Toggle error correction
-        case 868: M868(); break;                                  // M868: Set error correction threshold
-        case 869: M869(); break;                                  // M869: Report axis error
-      #endif
+          #if HAS_PRUSA_MMU3
+            { 704, M704 },                                        // M704: Preload to MMU
+            { 705, M705 },                                        // M705: Eject filament
+            { 706, M706 },                                        // M706: Cut filament
+            { 707, M707 },                                        // M707: Read from MMU register
+            { 708, M708 },                                        // M708: Write to MMU register
+            { 709, M709 },                                        // M709: MMU power & reset
+          #endif
 
-      #if ENABLED(MAGNETIC_PARKING_EXTRUDER)
-        case 951: M951(); break;                                  // M951: Set Magnetic Parking Extruder parameters
-      #endif
+          #if ENABLED(CONTROLLER_FAN_EDITABLE)
+            { 710, M710 },                                        // M710: Set Controller Fan settings
+          #endif
 
-      #if ENABLED(Z_STEPPER_AUTO_ALIGN)
-        case 422: M422(); break;                                  // M422: Set Z Stepper automatic alignment position using probe
-      #endif
+          #if ENABLED(DEBUG_GCODE_PARSER)
+            { 800, GCodeParser::debug },                          // M800: G-Code Parser Test for M
+          #endif
 
-      #if ENABLED(OTA_FIRMWARE_UPDATE)
-        case 936: M936(); break;                                  // M936: OTA update firmware.
-      #endif
+          #if ENABLED(GCODE_REPEAT_MARKERS)
+            { 808, M808 },                                        // M808: Set / Goto repeat markers
+          #endif
 
-      #if SPI_FLASH_BACKUP
-        case 993: M993(); break;                                  // M993: Backup SPI Flash to SD
-        case 994: M994(); break;                                  // M994: Load a Backup from SD to SPI Flash
-      #endif
+          #if ENABLED(GCODE_MACROS)
+            { 810, M810_819 },                                    // M810: Define/execute G-code macro
+            { 811, M810_819 },                                    // M811: Define/execute G-code macro
+            { 812, M810_819 },                                    // M812: Define/execute G-code macro
+            { 813, M810_819 },                                    // M813: Define/execute G-code macro
+            { 814, M810_819 },                                    // M814: Define/execute G-code macro
+            { 815, M810_819 },                                    // M815: Define/execute G-code macro
+            { 816, M810_819 },                                    // M816: Define/execute G-code macro
+            { 817, M810_819 },                                    // M817: Define/execute G-code macro
+            { 818, M810_819 },                                    // M818: Define/execute G-code macro
+            { 819, M810_819 },                                    // M819: Define/execute G-code macro
+            { 820, M820 },                                        // M820: Report macros to serial output
+          #endif
 
-      #if ENABLED(TOUCH_SCREEN_CALIBRATION)
-        case 995: M995(); break;                                  // M995: Touch screen calibration for TFT display
-      #endif
+          #if HAS_BED_PROBE
+            { 851, M851 },                                        // M851: Set Z Probe Z Offset
+          #endif
 
-      #if ENABLED(PLATFORM_M997_SUPPORT)
-        case 997: M997(); break;                                  // M997: Perform in-application firmware update
-      #endif
+          #if ENABLED(SKEW_CORRECTION_GCODE)
+            { 852, M852 },                                        // M852: Set Skew factors
+          #endif
 
-      case 999: M999(); break;                                    // M999: Restart after being Stopped
+          #if ENABLED(I2C_POSITION_ENCODERS)
+            { 860, M860 },                                        // M860: Report encoder module position
+            { 861, M861 },                                        // M861: Report encoder module status
+            { 862, M862 },                                        // M862: Perform axis test
+            { 863, M863 },                                        // M863: Calibrate steps/mm
+            { 864, M864 },                                        // M864: Change module address
+            { 865, M865 },                                        // M865: Check module firmware version
+            { 866, M866 },                                        // M866: Report axis error count
+            { 867, M867 },                                        // M867: Toggle error correction
+            { 868, M868 },                                        // M868: Set error correction threshold
+            { 869, M869 },                                        // M869: Report axis error
+          #endif
 
-      #if ENABLED(POWER_LOSS_RECOVERY)
-        case 413: M413(); break;                                  // M413: Enable/disable/query Power-Loss Recovery
-        case 1000: M1000(); break;                                // M1000: [INTERNAL] Resume from power-loss
-      #endif
+          #if HAS_PTC
+            { 871, M871 },                                        // M871: Print/reset/clear first layer temperature offset values
+          #endif
 
-      #if HAS_MEDIA
-        case 1001: M1001(); break;                                // M1001: [INTERNAL] Handle SD completion
-      #endif
+          #if ENABLED(HOST_PROMPT_SUPPORT)
+            { 876, TERN(EMERGENCY_PARSER, nullptr, M876) },       // M876: Handle Host prompt responses
+          #endif
 
-      #if DGUS_LCD_UI_MKS
-        case 1002: M1002(); break;                                // M1002: [INTERNAL] Tool-change and Relative E Move
-      #endif
+          #if ENABLED(LIN_ADVANCE)
+            { 900, M900 },                                        // M900: Set advance K factor.
+          #endif
 
-      #if ENABLED(ONE_CLICK_PRINT)
-        case 1003: M1003(); break;                                // M1003: [INTERNAL] Set the current dir to /
-      #endif
+          #if HAS_TRINAMIC_CONFIG
+            { 906, M906 },                                        // M906: Set motor current in milliamps using axis codes X, Y, Z, E
+          #endif
 
-      #if ENABLED(UBL_MESH_WIZARD)
-        case 1004: M1004(); break;                                // M1004: UBL Mesh Wizard
-      #endif
+          #if ANY(HAS_MOTOR_CURRENT_SPI, HAS_MOTOR_CURRENT_PWM, HAS_MOTOR_CURRENT_I2C, HAS_MOTOR_CURRENT_DAC)
+            { 907, M907 },                                        // M907: Set digital trimpot motor current using axis codes.
+            #if ANY(HAS_MOTOR_CURRENT_SPI, HAS_MOTOR_CURRENT_DAC)
+              { 908, M908 },                                      // M908: Control digital trimpot directly.
+              #if HAS_MOTOR_CURRENT_DAC
+                { 909, M909 },                                    // M909: Print digipot/DAC current value
+                { 910, M910 },                                    // M910: Commit digipot/DAC value to external EEPROM
+              #endif
+            #endif
+          #endif
 
-      #if ENABLED(MAX7219_GCODE)
-        case 7219: M7219(); break;                                // M7219: Set LEDs, columns, and rows
-      #endif
+          #if HAS_TRINAMIC_CONFIG
+            #if ENABLED(MONITOR_DRIVER_STATUS)
+              { 911, M911 },                                      // M911: Report TMC2130 prewarn triggered flags
+              { 912, M912 },                                      // M912: Clear TMC2130 prewarn triggered flags
+            #endif
+            #if ENABLED(HYBRID_THRESHOLD)
+              { 913, M913 },                                      // M913: Set HYBRID_THRESHOLD speed
+            #endif
+            #if USE_SENSORLESS
+              { 914, M914 },                                      // M914: Set StallGuard sensitivity
+            #endif
+            { 919, M919 },                                        // M919: Set stepper Chopper Times
+            #if ENABLED(EDITABLE_HOMING_CURRENT)
+              { 920, M920 },                                      // M920: Set Homing Current
+            #endif
+          #endif
 
-      #if ENABLED(HAS_MCP3426_ADC)
-        case 3426: M3426(); break;                                // M3426: Read MCP3426 ADC (over i2c)
-      #endif
+          #if HAS_MEDIA
+            { 928, M928 },                                        // M928: Start SD write
+          #endif
+
+          #if ENABLED(OTA_FIRMWARE_UPDATE)
+            { 936, M936 },                                        // M936: OTA update firmware.
+          #endif
+
+          #if ENABLED(MAGNETIC_PARKING_EXTRUDER)
+            { 951, M951 },                                        // M951: Set Magnetic Parking Extruder parameters
+          #endif
+
+          #if SPI_FLASH_BACKUP
+            { 993, M993 },                                        // M993: Backup SPI Flash to SD
+            { 994, M994 },                                        // M994: Load a Backup from SD to SPI Flash
+          #endif
 
-      default: parser.unknown_command_warning(); break;
+          #if ENABLED(TOUCH_SCREEN_CALIBRATION)
+            { 995, M995 },                                        // M995: Touch screen calibration for TFT display
+          #endif
+
+          #if ENABLED(PLATFORM_M997_SUPPORT)
+            { 997, M997 },                                        // M997: Perform in-application firmware update
+          #endif
+
+          { 999, M999 },                                          // M999: Restart after being Stopped
+
+          #if ENABLED(POWER_LOSS_RECOVERY)
+            { 1000, M1000 },                                      // M1000: [INTERNAL] Resume from power-loss
+          #endif
+
+          #if HAS_MEDIA
+            { 1001, M1001 },                                      // M1001: [INTERNAL] Handle SD completion
+          #endif
+
+          #if DGUS_LCD_UI_MKS
+            { 1002, M1002 },                                      // M1002: [INTERNAL] Tool-change and Relative E Move
+          #endif
+
+          #if ENABLED(ONE_CLICK_PRINT)
+            { 1003, M1003 },                                      // M1003: [INTERNAL] Set the current dir to /
+          #endif
+
+          #if ENABLED(UBL_MESH_WIZARD)
+            { 1004, M1004 },                                      // M1004: UBL Mesh Wizard
+          #endif
+
+          #if ENABLED(HAS_MCP3426_ADC)
+            { 3426, M3426 },                                      // M3426: Read MCP3426 ADC (over i2c)
+          #endif
+
+          #if ENABLED(MAX7219_GCODE)
+            { 7219, M7219 },                                      // M7219: Set LEDs, columns, and rows
+          #endif
+        };
+        static_assert(handlers_sorted(m_handlers, COUNT(m_handlers)), "M-code handlers must be sorted by code.");
+        if (!dispatch(m_handlers, COUNT(m_handlers))) parser.unknown_command_warning();
+      }
     }
     break;
 
@@ -1196,7 +1265,15 @@ void GcodeSuite::process_next_command() {
 
   if (DEBUGGING(ECHO)) {
     SERIAL_ECHO_START();
-    SERIAL_ECHOLN(command.buffer);
+    #if HAS_BINARY_COMMANDS
+      if (command.buffer[0] == parser.binary_command_mark) {
+        GCodeParser::binary_text_t line;
+        parser.binary_to_text(line, command.buffer);
+        SERIAL_ECHOLN(&line);
+      }
+      else
+    #endif
+        SERIAL_ECHOLN(command.buffer);
     #if ENABLED(M100_FREE_MEMORY_DUMPER)
       SERIAL_ECHOPGM("slot:", queue.ring_buffer.index_r);
       M100_dump_routine(F("   Command Queue:"), (const char*)&queue.ring_buffer, sizeof(queue.ring_buffer));
@@ -174,8 +174,10 @@
  * M145 - Set heatup values for materials on the LCD. H<hotend> B<bed> F<fan speed> for S<material> (0=PLA, 1=ABS)
  * M149 - Set temperature units. (Requires TEMPERATURE_UNITS_SUPPORT)
  * M150 - Set Status LED Color as R<red> U<green> B<blue> W<white> P<bright>. Values 0-255. (Requires BLINKM, RGB_LED, RGBW_LED, NEOPIXEL_LED, PCA9533, or PCA9632).
+ * M153 - Report planner statistics, or auto-report with interval of S<seconds>. (Requires AUTO_REPORT_PLANNER_STATS)
  * M154 - Auto-report position with interval of S<seconds>. (Requires AUTO_REPORT_POSITION)
  * M155 - Auto-report temperatures with interval of S<seconds>. (Requires AUTO_REPORT_TEMPERATURES)
+ * M156 - Report calls and time spent in each G-code handler. R to reset after the report. (Requires GCODE_PROFILER)
  * M163 - Set a single proportion for a mixing extruder. (Requires MIXING_EXTRUDER)
  * M164 - Commit the mix and save to a virtual tool (current, or as specified by 'S'). (Requires MIXING_EXTRUDER)
  * M165 - Set the mix for the mixing extruder (and current virtual tool) with parameters ABCDHI. (Requires MIXING_EXTRUDER and DIRECT_MIXING_IN_G1)
@@ -267,6 +269,7 @@
  * M554 - Get or set IP gateway. (Requires enabled Ethernet port)
  * M569 - Enable stealthChop on an axis. (Requires *_DRIVER_TYPE TMC(2130|2160|2208|2209|5130|5160))
  * M575 - Change the serial baud rate. (Requires BAUD_RATE_GCODE)
+ * M577 - Set the number of numbered lines acknowledged by each "ok". (Requires SERIAL_ACK_WINDOW)
  * M592 - Get or set Nonlinear Extrusion parameters. (Requires NONLINEAR_EXTRUSION)
  * M593 - Get or set input shaping parameters. (Requires INPUT_SHAPING_[XY])
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
@@ -514,14 +517,28 @@ private:
     friend void plan_arc(const xyze_pos_t&, const ab_float_t&, const bool, const uint8_t);
   #endif
 
+  // A G-code or M-code handler. A null handler accepts the code and does nothing.
+  typedef void (*handler_t)();
+  typedef struct { uint16_t code; handler_t handler; } handler_entry_t;
+
+  // Tables must be sorted by code for the binary search in dispatch()
+  static constexpr bool handlers_sorted(const handler_entry_t * const table, const uint16_t count) {
+    return count < 2 || (table[0].code < table[1].code && handlers_sorted(table + 1, count - 1));
+  }
+  static bool dispatch(const handler_entry_t table[], const uint16_t count);
+
   #if ENABLED(MARLIN_DEV_MODE)
     static void D(const int16_t dcode);
   #endif
 
   static void G0_G1(TERN_(HAS_FAST_MOVES, const bool fast_move=false));
+  FORCE_INLINE static void G0() { G0_G1(TERN_(HAS_FAST_MOVES, true)); }
+  FORCE_INLINE static void G1() { G0_G1(); }
 
   #if ENABLED(ARC_SUPPORT)
     static void G2_G3(const bool clockwise);
+    FORCE_INLINE static void G2() { G2_G3(true); }
+    FORCE_INLINE static void G3() { G2_G3(false); }
   #endif
 
   static void G4();
@@ -603,6 +620,7 @@ private:
 
   #if ENABLED(G38_PROBE_TARGET)
     static void G38(const int8_t subcode);
+    FORCE_INLINE static void G38() { if (WITHIN(parser.subcode, 2, TERN(G38_PROBE_AWAY, 5, 3))) G38(parser.subcode); }
   #endif
 
   #if HAS_MESH
@@ -625,13 +643,16 @@ private:
 
   #if SAVED_POSITIONS
     static void G60();
-    static void G61(int8_t slot=-1);
+    static void G61(int8_t slot);
+    FORCE_INLINE static void G61() { G61(-1); }
   #endif
 
   #if ENABLED(GCODE_MOTION_MODES)
     static void G80();
   #endif
 
+  FORCE_INLINE static void G90() { set_relative_mode(false); }
+  FORCE_INLINE static void G91() { set_relative_mode(true); }
   static void G92();
 
   #if ENABLED(CALIBRATION_GCODE)
@@ -644,6 +665,8 @@ private:
 
   #if HAS_CUTTER
     static void M3_M4(const bool is_M4);
+    FORCE_INLINE static void M3() { M3_M4(false); }
+    FORCE_INLINE static void M4() { M3_M4(true); }
     static void M5();
   #endif
 
@@ -855,6 +878,10 @@ private:
     static void M150();
   #endif
 
+  #if ENABLED(AUTO_REPORT_PLANNER_STATS)
+    static void M153();
+  #endif
+
   #if ENABLED(AUTO_REPORT_POSITION)
     static void M154();
   #endif
@@ -863,6 +890,10 @@ private:
     static void M155();
   #endif
 
+  #if ENABLED(GCODE_PROFILER)
+    static void M156();
+  #endif
+
   #if ENABLED(MIXING_EXTRUDER)
     static void M163();
     static void M164();
@@ -1153,6 +1184,10 @@ private:
     static void M575();
   #endif
 
+  #if ENABLED(SERIAL_ACK_WINDOW)
+    static void M577();
+  #endif
+
   #if ENABLED(NONLINEAR_EXTRUSION)
     static void M592();
     static void M592_report(const bool forReplay=true);
@@ -242,6 +242,12 @@ void GcodeSuite::M115() {
     // MEATPACK Compression
     cap_line(F("MEATPACK"), SERIAL_IMPL.has_feature(port, SerialFeature::MeatPack));
 
+    // MEATPACK Binary Frames
+    cap_line(F("MEATPACK_BINARY"), ENABLED(MEATPACK_BINARY_FRAMES) && SERIAL_IMPL.has_feature(port, SerialFeature::MeatPack));
+
+    // SERIAL_ACK_WINDOW (M577)
+    cap_line(F("ACK_WINDOW"), ENABLED(SERIAL_ACK_WINDOW));
+
     // CONFIG_EXPORT
     cap_line(F("CONFIG_EXPORT"), ENABLED(CONFIGURATION_EMBEDDING));
 
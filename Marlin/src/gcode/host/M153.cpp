@@ -0,0 +1,45 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(AUTO_REPORT_PLANNER_STATS)
+
+#include "../gcode.h"
+#include "../../module/planner.h"
+
+/**
+ * M153: Report planner statistics or set the auto-report interval.
+ *
+ *   M153 S<seconds> - Auto-report every S seconds. S0 to stop.
+ *   M153            - Report now. Statistics restart after every report.
+ */
+void GcodeSuite::M153() {
+
+  if (parser.seenval('S'))
+    planner.stats_auto_reporter.set_interval(parser.value_byte());
+  else
+    planner.report_stats();
+
+}
+
+#endif // AUTO_REPORT_PLANNER_STATS
@@ -0,0 +1,44 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(GCODE_PROFILER)
+
+#include "../gcode.h"
+#include "../../feature/gcode_profiler.h"
+
+/**
+ * M156: Report the time spent in each G-code handler
+ *
+ *   M156   - Report calls and time for each command since the last reset.
+ *   M156 R - Report, then reset the profile.
+ *   M156 S - Reset the profile without a report.
+ */
+void GcodeSuite::M156() {
+
+  if (!parser.seen_test('S')) gcodeProfiler.report();
+  if (parser.seen_test('R') || parser.seen_test('S')) gcodeProfiler.reset();
+
+}
+
+#endif // GCODE_PROFILER
@@ -0,0 +1,66 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SERIAL_ACK_WINDOW)
+
+#include "../gcode.h"
+#include "../queue.h"
+
+// Unacknowledged lines must fit in the receive buffer in case the queue can't take them
+#if RX_BUFFER_SIZE > MAX_CMD_SIZE
+  #define ACK_WINDOW_BYTES RX_BUFFER_SIZE
+#else
+  #define ACK_WINDOW_BYTES MAX_CMD_SIZE
+#endif
+
+/**
+ * M577: Get or set the number of numbered lines acknowledged by each "ok"
+ *
+ *   S<lines> Optional. Lines per "ok" on the port that sent M577 (0 or 1 for every line).
+ *            Limited to half of BUFSIZE.
+ *
+ * In this mode "ok N<line>" acknowledges all numbered lines up to <line>.
+ * An "ok" is held back until S lines are done or the command queue runs dry.
+ * Lines without a line number still get their own plain "ok".
+ *
+ * The reply grants the host its window:
+ *   L<lines> Commands the queue can hold
+ *   B<bytes> Bytes the host may have sent but not seen acknowledged
+ */
+void GcodeSuite::M577() {
+  const serial_index_t port = queue.ring_buffer.command_port();
+  if (!port.valid()) return;
+
+  GCodeQueue::SerialState &serial = GCodeQueue::serial_state[port.index];
+  if (parser.seenval('S')) {
+    queue.flush_acks(port);
+    // Acknowledge at most half the queue at once so the host can refill it before it runs dry
+    const uint8_t lines = _MIN(parser.value_byte(), (BUFSIZE) / 2);
+    serial.ack_batch = lines > 1 ? lines : 0;
+  }
+
+  SERIAL_ECHOLNPGM("M577 S", serial.ack_batch, " L", BUFSIZE, " B", ACK_WINDOW_BYTES);
+}
+
+#endif // SERIAL_ACK_WINDOW
@@ -28,6 +28,9 @@
 #include "../../module/motion.h"
 #include "../../module/planner.h"
 #include "../../module/temperature.h"
+#if ENABLED(FTM_ARC_BLOCKS)
+  #include "../../module/ft_motion.h"
+#endif
 
 #if N_ARC_CORRECTION < 1
   #undef N_ARC_CORRECTION
@@ -239,6 +242,87 @@ void plan_arc(
     hints.inv_duration = (scaled_fr_mm_s / flat_mm) * segments;
   #endif
 
+  #if ENABLED(FTM_ARC_BLOCKS)
+
+    /**
+     * With FT Motion active the whole arc can be queued as a few arc blocks
+     * that FT Motion traces exactly, instead of many short line segments.
+     * Each block turns at most a quarter circle so its chord stays long enough
+     * to step accurately. Leveling and soft endstops only apply to endpoints,
+     * so fall back to segments if either could bend the path.
+     */
+    const bool use_arc_blocks = ftMotion.cfg.active && !planner.leveling_active
+      #if HAS_SOFTWARE_ENDSTOPS
+        && !(soft_endstop.enabled() && (
+             center_P - radius < soft_endstop.min[axis_p] || center_P + radius > soft_endstop.max[axis_p]
+          || center_Q - radius < soft_endstop.min[axis_q] || center_Q + radius > soft_endstop.max[axis_q]
+        ))
+      #endif
+    ;
+
+    if (use_arc_blocks) {
+      const uint8_t pieces = _MAX(1, CEIL(abs_angular_travel * (2.0f / M_PI) - 0.0001f));
+      const float piece_angle = angular_travel / pieces;
+
+      // Helical length of each piece
+      hints.millimeters = SQRT(sq(flat_mm)
+        GANG_N(SUB2(NUM_AXES),
+          + sq(travel_L), + sq(travel_I), + sq(travel_J), + sq(travel_K),
+          + sq(travel_U), + sq(travel_V), + sq(travel_W)
+        )
+      ) / pieces;
+
+      const float limiting_accel = _MIN(planner.settings.max_acceleration_mm_per_s2[axis_p], planner.settings.max_acceleration_mm_per_s2[axis_q]),
+                  limiting_speed = _MIN(planner.settings.max_feedrate_mm_s[axis_p], planner.settings.max_feedrate_mm_s[axis_q]),
+                  limiting_speed_sqr = _MIN(sq(limiting_speed), limiting_accel * radius, sq(scaled_fr_mm_s));
+
+      xyze_pos_t raw;
+      for (uint8_t i = 1; i <= pieces; i++) {
+        thermalManager.task();
+
+        // Start of this piece relative to the center
+        const float T0 = (i - 1) * piece_angle, cos_T0 = cos(T0), sin_T0 = sin(T0);
+        hints.arc = {
+          piece_angle, radius,
+          { -offset[0] * cos_T0 + offset[1] * sin_T0, -offset[0] * sin_T0 - offset[1] * cos_T0 },
+          axis_p, axis_q
+        };
+
+        if (i < pieces) {
+          const float Ti = i * piece_angle, cos_Ti = cos(Ti), sin_Ti = sin(Ti), frac = float(i) / pieces;
+          raw[axis_p] = center_P - offset[0] * cos_Ti + offset[1] * sin_Ti;
+          raw[axis_q] = center_Q - offset[0] * sin_Ti - offset[1] * cos_Ti;
+          ARC_LIJKUVWE_CODE(
+            raw[axis_l] = start_L + travel_L * frac,
+            raw.i       = start_I + travel_I * frac,
+            raw.j       = start_J + travel_J * frac,
+            raw.k       = start_K + travel_K * frac,
+            raw.u       = start_U + travel_U * frac,
+            raw.v       = start_V + travel_V * frac,
+            raw.w       = start_W + travel_W * frac,
+            raw.e       = start_E + travel_E * frac
+          );
+          hints.safe_exit_speed_sqr = _MIN(limiting_speed_sqr, 2 * limiting_accel * flat_mm * (pieces - i) / pieces);
+        }
+        else {
+          raw = cart;
+          hints.safe_exit_speed_sqr = 0.0f;
+        }
+
+        apply_motion_limits(raw);
+
+        if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
+          break;
+
+        hints.curve_radius = radius;
+      }
+
+      current_position = cart;
+      return;
+    }
+
+  #endif // FTM_ARC_BLOCKS
+
   /**
    * Vector rotation by transformation matrix: r is the original vector, r_T is the rotated vector,
    * and phi is the angle of rotation. Based on the solution approach by Jens Geisler.
@@ -51,6 +51,10 @@ uint16_t GCodeParser::codenum;
   uint8_t GCodeParser::subcode;
 #endif
 
+#if HAS_BINARY_COMMANDS
+  bool GCodeParser::binary_values;
+#endif
+
 #if ENABLED(GCODE_MOTION_MODES)
   int16_t GCodeParser::motion_mode_codenum = -1;
   #if USE_GCODE_SUBCODES
@@ -80,6 +84,7 @@ void GCodeParser::reset() {
   command_letter = '?';                 // No command letter
   codenum = 0;                          // No command code
   TERN_(USE_GCODE_SUBCODES, subcode = 0); // No command sub-code
+  TERN_(HAS_BINARY_COMMANDS, binary_values = false); // Values are text
   #if ENABLED(FASTER_GCODE_PARSER)
     codebits = 0;                       // No codes yet
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
@@ -114,6 +119,10 @@ void GCodeParser::parse(char *p) {
 
   reset(); // No codes to report
 
+  #if HAS_BINARY_COMMANDS
+    if (*p == binary_command_mark) return parse_binary(p);
+  #endif
+
   auto uppercase = [](char c) {
     return TERN0(GCODE_CASE_INSENSITIVE, WITHIN(c, 'a', 'z')) ? c + 'A' - 'a' : c;
   };
@@ -370,6 +379,43 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if HAS_BINARY_COMMANDS
+
+  /**
+   * Populate the command line state from a binary record stored by GCodeQueue:
+   * The letter, code number, and field count, then a letter and a float for each field.
+   * Values are read in place by value_float, so no text is ever converted.
+   */
+  void GCodeParser::parse_binary(char * const p) {
+    command_ptr = p;
+    command_letter = p[1];
+    codenum = uint8_t(p[2]);
+    binary_values = true;
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      motion_mode_codenum = codenum;
+      TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = 0);
+    #endif
+
+    char *v = p + 4;
+    for (uint8_t i = p[3]; i--; v += 1 + sizeof(float)) set(v[0], v + 1);
+  }
+
+  /**
+   * Convert a binary record back to G-code text for the
+   * command echo and for writing to SD.
+   */
+  void GCodeParser::binary_to_text(binary_text_t &line, const char * const p) {
+    line.set(p[1], int(uint8_t(p[2])));
+    for (const char *v = p + 4, * const end = v + p[3] * (1 + sizeof(float)); v < end; v += 1 + sizeof(float)) {
+      float f;
+      memcpy(&f, v + 1, sizeof(f));
+      line.append(' ', v[0], p_float_t(f, 5));
+    }
+  }
+
+#endif
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
   // Parse the next parameter as a new command
@@ -89,6 +89,13 @@ public:
     static uint8_t subcode;               // .1
   #endif
 
+  #if HAS_BINARY_COMMANDS
+    // A command stored as a binary record starts with this byte, which G-code text can't
+    static constexpr char binary_command_mark = 0x01;
+    static bool binary_values;            // Parameter values are floats instead of text
+    static float binary_value() { float f; memcpy(&f, value_ptr, sizeof(f)); return f; }
+  #endif
+
   #if ENABLED(GCODE_MOTION_MODES)
     static int16_t motion_mode_codenum;
     #if USE_GCODE_SUBCODES
@@ -148,7 +155,7 @@ public:
       if (b) {
         if (param[ind]) {
           char * const ptr = command_ptr + param[ind];
-          value_ptr = (valid_number(ptr) || TERN0(GCODE_QUOTED_STRINGS, *(ptr - 1) == '"')) ? ptr : nullptr;
+          value_ptr = (TERN0(HAS_BINARY_COMMANDS, binary_values) || valid_number(ptr) || TERN0(GCODE_QUOTED_STRINGS, *(ptr - 1) == '"')) ? ptr : nullptr;
         }
         else
           value_ptr = nullptr;
@@ -236,6 +243,15 @@ public:
   // This uses 54 bytes of SRAM to speed up seen/value
   static void parse(char * p);
 
+  #if HAS_BINARY_COMMANDS
+    // Populate all fields from a binary record stored by GCodeQueue
+    static void parse_binary(char * const p);
+
+    // Get a binary record as a line of G-code, with room for a line ending
+    typedef MString<MAX_CMD_SIZE + 2> binary_text_t;
+    static void binary_to_text(binary_text_t &line, const char * const p);
+  #endif
+
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     // Parse the next parameter as a new command
     static bool chain();
@@ -256,6 +272,9 @@ public:
   // Float removes 'E' to prevent scientific notation interpretation
   static float value_float() {
     if (!value_ptr) return 0;
+    #if HAS_BINARY_COMMANDS
+      if (binary_values) return binary_value();
+    #endif
     char *e = value_ptr;
     for (;;) {
       const char c = *e;
@@ -272,8 +291,13 @@ public:
   }
 
   // Code value as a long or ulong
-  static int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #if HAS_BINARY_COMMANDS
+    static int32_t value_long() { return value_ptr ? binary_values ? int32_t(binary_value()) : strtol(value_ptr, nullptr, 10) : 0L; }
+    static uint32_t value_ulong() { return value_ptr ? binary_values ? uint32_t(binary_value()) : strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #else
+    static int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
+    static uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #endif
 
   // Code value for use as time
   static millis_t value_millis() { return value_ulong(); }
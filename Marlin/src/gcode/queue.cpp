@@ -49,6 +49,10 @@ GCodeQueue queue;
   #include "../feature/repeat.h"
 #endif
 
+#if ENABLED(DIRECT_STEPPING_FILES)
+  #include "../feature/direct_stepping.h"
+#endif
+
 // Frequently used G-code strings
 PGMSTR(G28_STR, "G28");
 
@@ -91,6 +95,65 @@ PGM_P GCodeQueue::injected_commands_P; // = nullptr
  */
 char GCodeQueue::injected_commands[64]; // = { 0 }
 
+#if ENABLED(GCODE_PREPARSED_MOVES)
+
+  /**
+   * Convert a G0-G3 command into a binary record (see GCodeParser::parse_binary)
+   * so its values are converted to floats now, while the command waits in the
+   * queue, and the parser has no text to scan when the move runs.
+   * Anything unusual is left as text for the regular parser.
+   */
+  static void preparse_move(char * const cmd) {
+    // Keep the original text for a file being written by M28
+    if (TERN0(HAS_MEDIA, card.flag.saving)) return;
+
+    char *p = cmd;
+    while (*p == ' ') ++p;
+
+    // Skip the line number, unless ADVANCED_OK needs it for the reply
+    if (*p == 'N') {
+      if (ENABLED(ADVANCED_OK)) return;
+      ++p;
+      while (NUMERIC_SIGNED(*p)) ++p;
+      while (*p == ' ') ++p;
+    }
+
+    if (p[0] != 'G' || !WITHIN(p[1], '0', TERN(ARC_SUPPORT, '3', '1')) || DECIMAL(p[2])) return;
+
+    char rec[MAX_CMD_SIZE] = { GCodeParser::binary_command_mark, 'G', char(p[1] - '0'), 0 };
+    char *out = rec + 4;
+    uint8_t count = 0;
+    for (p += 2; ; ) {
+      while (*p == ' ') ++p;
+      if (!*p || *p == '*') break;
+
+      // Each field must be a letter and a plain number
+      const char letter = *p++;
+      if (!WITHIN(letter, 'A', 'Z') || !GCodeParser::valid_number(p) || count == (MAX_CMD_SIZE - 4) / (1 + sizeof(float))) return;
+
+      // Like value_float, read digits only so 'E' isn't taken as an exponent
+      char *end = p;
+      while (DECIMAL_SIGNED(*end)) ++end;
+      const char c = *end;
+      *end = '\0';
+      char *e;
+      const float f = strtof(p, &e);
+      *end = c;
+      if (e != end) return;
+
+      *out++ = letter;
+      memcpy(out, &f, sizeof(f));
+      out += sizeof(f);
+      count++;
+      p = end;
+    }
+
+    rec[3] = count;
+    memcpy(cmd, rec, out - rec);
+  }
+
+#endif
+
 /**
  * Commit the accumulated G-code command to the ring buffer,
  * also setting its origin info.
@@ -98,10 +161,58 @@ char GCodeQueue::injected_commands[64]; // = { 0 }
 void GCodeQueue::RingBuffer::commit_command(const bool skip_ok
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
 ) {
+  #if ENABLED(SERIAL_ACK_WINDOW)
+    // Keep the line number for M577 before the text is pre-parsed or executed
+    const char *n = commands[index_w].buffer;
+    while (*n == ' ') ++n;
+    commands[index_w].line_N = (*n == 'N' && NUMERIC(n[1])) ? strtol(n + 1, nullptr, 10) : -1;
+  #endif
+  TERN_(GCODE_PREPARSED_MOVES, preparse_move(commands[index_w].buffer));
   commands[index_w].skip_ok = skip_ok;
   TERN_(HAS_MULTI_SERIAL, commands[index_w].port = serial_ind);
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
+  TERN_(COMMAND_ARENA, commit_arena());
   advance_w();
+  // A full queue's write slot is still the read slot, so it gets its buffer in advance_r
+  TERN_(COMMAND_ARENA, if (length < BUFSIZE) commands[index_w].buffer = &arena[arena_w]);
+}
+
+#if ENABLED(COMMAND_ARENA)
+
+  /**
+   * Keep only the bytes the new command uses and
+   * find where the next command will be written.
+   */
+  void GCodeQueue::RingBuffer::commit_arena() {
+    const char * const cmd = commands[index_w].buffer;
+    #if HAS_BINARY_COMMANDS
+      // Binary records hold floats, so they have a length instead of a terminator
+      const uint16_t size = cmd[0] == GCodeParser::binary_command_mark ? 4 + cmd[3] * (1 + sizeof(float)) : strlen(cmd) + 1;
+    #else
+      const uint16_t size = strlen(cmd) + 1;
+    #endif
+    arena_end = (cmd - arena) + size;
+    arena_w = arena_end + MAX_CMD_SIZE <= COMMAND_ARENA_SIZE ? arena_end : 0;
+  }
+
+#endif
+
+/**
+ * The number of commands that are sure to fit in the queue.
+ * With COMMAND_ARENA each one is assumed to be MAX_CMD_SIZE long.
+ */
+uint8_t GCodeQueue::RingBuffer::free_commands() const {
+  #if ENABLED(COMMAND_ARENA)
+    if (!arena_room()) return 0;
+    uint16_t used = 0;
+    if (length) {
+      const uint16_t r = commands[index_r].buffer - arena;
+      used = r < arena_end ? arena_end - r : COMMAND_ARENA_SIZE - r + arena_end;
+    }
+    return _MIN(BUFSIZE - length, _MAX(1, (COMMAND_ARENA_SIZE - used) / MAX_CMD_SIZE));
+  #else
+    return BUFSIZE - length;
+  #endif
 }
 
 /**
@@ -112,7 +223,7 @@ void GCodeQueue::RingBuffer::commit_command(const bool skip_ok
 bool GCodeQueue::RingBuffer::enqueue(const char *cmd, const bool skip_ok/*=true*/
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
 ) {
-  if (*cmd == ';' || length >= BUFSIZE) return false;
+  if (*cmd == ';' || full()) return false;
   strcpy(commands[index_w].buffer, cmd);
   commit_command(skip_ok OPTARG(HAS_MULTI_SERIAL, serial_ind));
   return true;
@@ -236,6 +347,9 @@ void GCodeQueue::enqueue_now_P(PGM_P const pgcode) {
  *   N<int>  Line number of the command, if any
  *   P<int>  Planner space remaining
  *   B<int>  Block queue space remaining
+ *
+ * With SERIAL_ACK_WINDOW a port set up by M577 gets one
+ * "ok N<int>" for several numbered lines instead.
  */
 void GCodeQueue::RingBuffer::ok_to_send() {
   #if NO_TIMEOUTS > 0
@@ -249,6 +363,19 @@ void GCodeQueue::RingBuffer::ok_to_send() {
     PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));   // Reply to the serial port that sent the command
   #endif
   if (command.skip_ok) return;
+  #if ENABLED(SERIAL_ACK_WINDOW)
+    const serial_index_t ack_ind = command_port();
+    SerialState &serial = serial_state[ack_ind.index];
+    if (serial.ack_batch) {
+      if (command.line_N >= 0) {
+        // Hold the "ok" until the batch is full or nothing else is queued
+        serial.ack_N = command.line_N;
+        if (++serial.acks_pending >= serial.ack_batch || length <= 1) flush_acks(ack_ind);
+        return;
+      }
+      flush_acks(ack_ind); // Acknowledge held lines ahead of this one
+    }
+  #endif
   SERIAL_ECHOPGM(STR_OK);
   #if ENABLED(ADVANCED_OK)
     char* p = command.buffer;
@@ -257,7 +384,7 @@ void GCodeQueue::RingBuffer::ok_to_send() {
       while (NUMERIC_SIGNED(*p))
         SERIAL_CHAR(*p++);
     }
-    SERIAL_ECHOPGM_P(SP_P_STR, planner.moves_free(), SP_B_STR, BUFSIZE - length);
+    SERIAL_ECHOPGM_P(SP_P_STR, planner.moves_free(), SP_B_STR, free_commands());
   #endif
   SERIAL_EOL();
 }
@@ -271,11 +398,28 @@ void GCodeQueue::flush_and_request_resend(const serial_index_t serial_ind) {
     if (!serial_ind.valid()) return;              // Optimization here, skip if the command came from SD or Flash Drive
     PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));   // Reply to the serial port that sent the command
   #endif
+  TERN_(SERIAL_ACK_WINDOW, flush_acks(serial_ind));
   SERIAL_FLUSH();
   SERIAL_ECHOLNPGM(STR_RESEND, serial_state[serial_ind.index].last_N + 1);
   SERIAL_ECHOLNPGM(STR_OK);
 }
 
+#if ENABLED(SERIAL_ACK_WINDOW)
+
+  void GCodeQueue::flush_acks(const serial_index_t serial_ind) {
+    SerialState &serial = serial_state[serial_ind.index];
+    if (!serial.acks_pending) return;
+    serial.acks_pending = 0;
+    PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));
+    SERIAL_ECHOPGM(STR_OK " N", serial.ack_N);
+    #if ENABLED(ADVANCED_OK)
+      SERIAL_ECHOPGM_P(SP_P_STR, planner.moves_free(), SP_B_STR, ring_buffer.free_commands());
+    #endif
+    SERIAL_EOL();
+  }
+
+#endif
+
 static bool serial_data_available(serial_index_t index) {
   const int a = SERIAL_IMPL.available(index);
   #if ENABLED(RX_BUFFER_MONITOR) && RX_BUFFER_SIZE
@@ -327,6 +471,7 @@ void GCodeQueue::gcode_line_error(FSTR_P const ferr, const serial_index_t serial
 }
 
 FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", but not "M290", etc
+  if (TERN0(HAS_BINARY_COMMANDS, cmd[0] == GCodeParser::binary_command_mark)) return false;
   const char * const m29 = strstr_P(cmd, PSTR("M29"));
   return m29 && !NUMERIC(m29[3]);
 }
@@ -337,7 +482,7 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
 #define PS_PAREN  3
 #define PS_ESC    4
 
-inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline void process_stream_char(const char c, uint8_t &sis, char * const buff, int &ind) {
 
   if (sis == PS_EOL) return;    // EOL comment or overflow
 
@@ -393,7 +538,7 @@ inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD
  * Handle a line being completed. For an empty line
  * keep sensor readings going and watchdog alive.
  */
-inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline bool process_line_done(uint8_t &sis, char * const buff, int &ind) {
   sis = PS_NORMAL;                    // "Normal" Serial Input State
   buff[ind] = '\0';                   // Of course, I'm a Terminator.
   const bool is_empty = (ind == 0);   // An empty line?
@@ -404,6 +549,192 @@ inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
   return is_empty;                    // Inform the caller
 }
 
+/**
+ * Give an alert for movement commands when the machine is stopped,
+ * process critical commands early, then add the line to the queue.
+ */
+void GCodeQueue::queue_serial_command(char * const line, char * const command, const serial_index_t serial_ind) {
+
+  //
+  // Movement commands give an alert when the machine is stopped
+  //
+
+  if (IsStopped()) {
+    char* gpos = strchr(command, 'G');
+    if (gpos) {
+      switch (strtol(gpos + 1, nullptr, 10)) {
+        case 0 ... 1:
+        TERN_(ARC_SUPPORT, case 2 ... 3:)
+        TERN_(BEZIER_CURVE_SUPPORT, case 5:)
+          PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));  // Reply to the serial port that sent the command
+          SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
+          LCD_MESSAGE(MSG_STOPPED);
+          break;
+      }
+    }
+  }
+
+  #if DISABLED(EMERGENCY_PARSER)
+    // Process critical commands early
+    if (command[0] == 'M') switch (command[3]) {
+      case '8': if (command[2] == '0' && command[1] == '1') { wait_for_heatup = false; TERN_(HAS_MARLINUI_MENU, wait_for_user = false); } break;
+      case '2': if (command[2] == '1' && command[1] == '1') kill(FPSTR(M112_KILL_STR), nullptr, true); break;
+      case '0': if (command[1] == '4' && command[2] == '1') quickstop_stepper(); break;
+    }
+  #endif
+
+  #if NO_TIMEOUTS > 0
+    last_command_time = millis();
+  #endif
+
+  ring_buffer.enqueue(line, false OPTARG(HAS_MULTI_SERIAL, serial_ind));
+}
+
+#if ENABLED(MEATPACK_BINARY_FRAMES)
+
+  #define PS_BINARY      8
+  #define PS_BINARY_ESC  9
+  #define PS_BINARY_SYNC 10
+
+  /**
+   * Collect a binary frame passed on by MeatPack. Every frame starts with a mark that
+   * can't appear anywhere else, so after an error the next frame is easy to find.
+   * Return 'true' when the frame is complete or its length byte is already unusable.
+   */
+  inline bool process_binary_char(uint8_t c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+    if (c == MeatPack::kFrameMark) {  // A new frame, even if the last one was cut short
+      sis = PS_BINARY;
+      ind = 0;
+      return false;
+    }
+
+    switch (sis) {
+      case PS_BINARY_SYNC: return false;      // Wait for the next frame
+      case PS_BINARY_ESC:
+        c ^= MeatPack::kFrameEscapeXor;       // Unescape a mark or escape byte
+        sis = PS_BINARY;
+        break;
+      default:
+        if (c == MeatPack::kFrameEscape) { sis = PS_BINARY_ESC; return false; }
+    }
+
+    buff[ind++] = c;
+
+    const uint8_t len = buff[0];
+    return ind == 1 ? !WITHIN(len, MeatPack::kMinFrameLength, MeatPack::kMaxFrameLength) : ind >= len + 2;
+  }
+
+  /**
+   * Check the line number and checksum of a binary frame, then add its command to the queue.
+   * Moves are stored for GCodeParser::parse_binary so their values are never converted to text.
+   * Return 'false' if a resend was requested.
+   */
+  bool GCodeQueue::binary_frame_done(const serial_index_t serial_ind) {
+    SerialState &serial = serial_state[serial_ind.index];
+    const uint8_t * const frame = (uint8_t*)serial.line_buffer, len = frame[0];
+
+    serial.input_state = PS_NORMAL;
+    serial.count = 0;
+
+    if (len == MeatPack::kFrameEnd) {                             // Back to text
+      serial.binary_frames = false;
+      return true;
+    }
+
+    auto frame_error = [&](FSTR_P const ferr) {
+      gcode_line_error(ferr, serial_ind);
+      serial.input_state = PS_BINARY_SYNC;                        // Skip anything up to the next frame
+      return false;
+    };
+
+    if (len == MeatPack::kFrameBad) return frame_error(F(STR_ERR_CHECKSUM_MISMATCH));
+
+    uint8_t checksum = 0;
+    for (uint8_t i = 0; i <= len; ++i) checksum ^= frame[i];
+    if (checksum != frame[len + 1]) return frame_error(F(STR_ERR_CHECKSUM_MISMATCH));
+
+    const uint8_t op = frame[1];
+    char * const text = serial.line_buffer + 4;
+    if (op == MPBinary_Text) serial.line_buffer[len + 1] = '\0';  // Terminate the text over the checksum
+
+    // Only the low 16 bits of the line number are sent
+    long gcode_N = serial.last_N + int16_t(uint16_t(frame[2] | (frame[3] << 8)) - uint16_t(serial.last_N));
+
+    const bool M110 = op == MPBinary_Text && !!strstr_P(text, PSTR("M110"));
+    if (M110) {
+      char * const n2pos = strchr(text + 4, 'N');
+      if (n2pos) gcode_N = strtol(n2pos + 1, nullptr, 10);
+    }
+
+    // The line number must be in the correct sequence.
+    if (gcode_N != serial.last_N + 1 && !M110) {
+      // A request-for-resend frame was already in transit so we got two - oops!
+      if (WITHIN(gcode_N, serial.last_N - 1, serial.last_N)) return true;
+      // A corrupted frame or too high, indicating a lost frame
+      return frame_error(F(STR_ERR_LINE_NO));
+    }
+
+    if (op == MPBinary_Text) {
+      serial.last_N = gcode_N;
+      queue_serial_command(text, text, serial_ind);
+      return true;
+    }
+
+    const bool has_deltas = op & MPBinary_Delta;
+    const uint8_t code = op & ~MPBinary_Delta,
+                  mask = frame[4], deltas = has_deltas ? frame[5] : 0;
+
+    // Check the opcode and the length before any field is changed
+    constexpr uint8_t field_count = COUNT(serial.binary_fields);
+    uint8_t end = has_deltas ? 6 : 5;
+    for (uint8_t i = 0; i < field_count; ++i)
+      if (TEST(mask, i)) end += TEST(deltas, i) ? sizeof(int16_t) : sizeof(float);
+    if (!WITHIN(code, MPBinary_G0, MPBinary_G1) || (mask >> field_count) || (deltas & ~mask) || end != len + 1)
+      return frame_error(F(STR_ERR_CHECKSUM_MISMATCH));
+
+    serial.last_N = gcode_N;
+
+    // Store the letter, code, and field count, followed by a letter and a float for each field
+    char * const cmd = ring_buffer.commands[ring_buffer.index_w].buffer;
+    cmd[0] = GCodeParser::binary_command_mark;
+    cmd[1] = 'G';
+    cmd[2] = code - MPBinary_G0;
+    cmd[3] = 0;
+    char *out = cmd + 4;
+    const uint8_t *in = frame + (has_deltas ? 6 : 5);
+    for (uint8_t i = 0; i < field_count; ++i) {
+      if (!TEST(mask, i)) continue;
+      float &f = serial.binary_fields[i];
+      if (TEST(deltas, i)) {
+        f += int16_t(in[0] | (in[1] << 8)) * 0.001f;
+        in += sizeof(int16_t);
+      }
+      else {
+        memcpy(&f, in, sizeof(f));                                // Frames and all supported MCUs are little-endian
+        in += sizeof(f);
+      }
+      *out++ = MP_BINARY_FIELDS[i];
+      memcpy(out, &f, sizeof(f));
+      out += sizeof(f);
+      cmd[3]++;
+    }
+
+    if (IsStopped()) {
+      PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));
+      SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
+      LCD_MESSAGE(MSG_STOPPED);
+    }
+
+    #if NO_TIMEOUTS > 0
+      last_command_time = millis();
+    #endif
+
+    ring_buffer.commit_command(false OPTARG(HAS_MULTI_SERIAL, serial_ind));
+    return true;
+  }
+
+#endif // MEATPACK_BINARY_FRAMES
+
 /**
  * Get all commands waiting on the serial port and queue them.
  * Exit when the buffer is full or when no more characters are
@@ -461,6 +792,16 @@ void GCodeQueue::get_serial_commands() {
       const char serial_char = (char)c;
       SerialState &serial = serial_state[p];
 
+      #if ENABLED(MEATPACK_BINARY_FRAMES)
+        // Binary frame bytes may look like line ends or comments, so they're collected whole.
+        // Only a port with frames turned on can start one, so stray bytes on text ports are ignored.
+        if (serial.input_state >= PS_BINARY || (c == MeatPack::kFrameMark && serial.binary_frames)) {
+          if (process_binary_char(c, serial.input_state, serial.line_buffer, serial.count) && !binary_frame_done(p))
+            break;
+          continue;
+        }
+      #endif
+
       if (ISEOL(serial_char)) {
 
         // Reset our state, continue if the line was empty
@@ -516,40 +857,8 @@ void GCodeQueue::get_serial_commands() {
           }
         #endif
 
-        //
-        // Movement commands give an alert when the machine is stopped
-        //
-
-        if (IsStopped()) {
-          char* gpos = strchr(command, 'G');
-          if (gpos) {
-            switch (strtol(gpos + 1, nullptr, 10)) {
-              case 0 ... 1:
-              TERN_(ARC_SUPPORT, case 2 ... 3:)
-              TERN_(BEZIER_CURVE_SUPPORT, case 5:)
-                PORT_REDIRECT(SERIAL_PORTMASK(p));     // Reply to the serial port that sent the command
-                SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
-                LCD_MESSAGE(MSG_STOPPED);
-                break;
-            }
-          }
-        }
-
-        #if DISABLED(EMERGENCY_PARSER)
-          // Process critical commands early
-          if (command[0] == 'M') switch (command[3]) {
-            case '8': if (command[2] == '0' && command[1] == '1') { wait_for_heatup = false; TERN_(HAS_MARLINUI_MENU, wait_for_user = false); } break;
-            case '2': if (command[2] == '1' && command[1] == '1') kill(FPSTR(M112_KILL_STR), nullptr, true); break;
-            case '0': if (command[1] == '4' && command[2] == '1') quickstop_stepper(); break;
-          }
-        #endif
-
-        #if NO_TIMEOUTS > 0
-          last_command_time = ms;
-        #endif
-
         // Add the command to the queue
-        ring_buffer.enqueue(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
+        queue_serial_command(serial.line_buffer, command, p);
       }
       else
         process_stream_char(serial_char, serial.input_state, serial.line_buffer, serial.count);
@@ -572,12 +881,23 @@ void GCodeQueue::get_serial_commands() {
     // Get commands if there are more in the file
     if (!card.isStillFetching()) return;
 
+    // Don't read past a G6 page write until its page is free
+    if (TERN0(DIRECT_STEPPING_FILES, page_manager.media_page_waiting() && !page_manager.load_media_page())) return;
+
     int sd_count = 0;
     while (!ring_buffer.full() && !card.eof()) {
       const int16_t n = card.get();
       const bool card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
 
+      #if ENABLED(DIRECT_STEPPING_FILES)
+        // A G6 page write takes the place of a line
+        if (!sd_count && n == DirectStepping::Config::CONTROL_CHAR) {
+          if (!page_manager.load_media_page()) break;
+          continue;
+        }
+      #endif
+
       CommandLine &command = ring_buffer.commands[ring_buffer.index_w];
       const char sd_char = (char)n;
       const bool is_eol = ISEOL(sd_char);
@@ -613,15 +933,49 @@ void GCodeQueue::get_serial_commands() {
 
 #endif // HAS_MEDIA
 
+#if ENABLED(BINARY_GCODE_STREAM)
+
+  /**
+   * Decode G-code from the last BinaryStream packet into the queue.
+   * Lines may span packets, so the partial line is kept in the
+   * protocol's line buffer and only copied into the queue once complete.
+   * Return true while the packet still has data.
+   */
+  inline bool GCodeQueue::get_stream_commands() {
+    char * const line = GCodeStreamProtocol::line_buffer;
+    while (GCodeStreamProtocol::pending() && !ring_buffer.full()) {
+      const int16_t n = GCodeStreamProtocol::get();
+      if (n < 0) break;
+
+      const char stream_char = (char)n;
+      if (ISEOL(stream_char)) {
+        // The host gets one "ok<sync>" per packet, so skip the per-command "ok"
+        if (!process_line_done(GCodeStreamProtocol::line_state, line, GCodeStreamProtocol::line_index)) {
+          ring_buffer.enqueue(line, true OPTARG(HAS_MULTI_SERIAL, card.transfer_port_index));
+          GCodeStreamProtocol::line_queued();
+        }
+      }
+      else
+        process_stream_char(stream_char, GCodeStreamProtocol::line_state, line, GCodeStreamProtocol::line_index);
+    }
+    return GCodeStreamProtocol::pending();
+  }
+
+#endif // BINARY_GCODE_STREAM
+
 /**
  * Add to the circular command queue the next command from:
  *  - The command-injection queues (injected_commands_P, injected_commands)
+ *  - G-code streamed over the binary protocol
  *  - The active serial input (usually USB)
  *  - The SD card file being actively printed
  */
 void GCodeQueue::get_available_commands() {
   if (ring_buffer.full()) return;
 
+  // Use up the last streamed packet before taking new input
+  if (TERN0(BINARY_GCODE_STREAM, get_stream_commands())) return;
+
   get_serial_commands();
 
   TERN_(HAS_MEDIA, get_sdcard_commands());
@@ -685,7 +1039,24 @@ void GCodeQueue::advance() {
       }
       else {
         // Write the string from the read buffer to SD
-        card.write_command(cmd);
+        #if HAS_BINARY_COMMANDS
+          if (cmd[0] == GCodeParser::binary_command_mark) {
+            // Binary records go into the file as text
+            GCodeParser::binary_text_t line;
+            GCodeParser::binary_to_text(line, cmd);
+            card.write_command(&line);
+          }
+          else
+        #endif
+        {
+          #if ENABLED(COMMAND_ARENA)
+            // The line ending is added in place, so copy the command clear of the next one
+            MString<MAX_CMD_SIZE + 2> line(cmd);
+            card.write_command(&line);
+          #else
+            card.write_command(cmd);
+          #endif
+        }
         if (card.flag.logging)
           gcode.process_next_command(); // The card is saving because it's logging
         else
@@ -710,7 +1081,7 @@ void GCodeQueue::advance() {
   void GCodeQueue::report_buffer_statistics() {
     SERIAL_ECHOLNPGM("D576"
       " P:", planner.moves_free(),         " ", planner_buffer_underruns, " (", max_planner_buffer_empty_duration, ")"
-      " B:", BUFSIZE - ring_buffer.length, " ", command_buffer_underruns, " (", max_command_buffer_empty_duration, ")"
+      " B:", ring_buffer.free_commands(), " ", command_buffer_underruns, " (", max_command_buffer_empty_duration, ")"
     );
     command_buffer_underruns = planner_buffer_underruns = 0;
     max_command_buffer_empty_duration = max_planner_buffer_empty_duration = 0;
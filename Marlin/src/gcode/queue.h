@@ -28,6 +28,10 @@
 
 #include "../inc/MarlinConfig.h"
 
+#if ENABLED(MEATPACK_BINARY_FRAMES)
+  #include "../feature/meatpack.h"
+#endif
+
 class GCodeQueue {
 public:
   /**
@@ -43,13 +47,32 @@ public:
     int count;                      //!< Number of characters read in the current line of serial input
     char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator
     uint8_t input_state;            //!< The input state
+    #if ENABLED(SERIAL_ACK_WINDOW)
+      uint8_t ack_batch,            //!< Numbered lines acknowledged by each "ok" (set by M577, 0 for every line)
+              acks_pending;         //!< Numbered lines done but not yet acknowledged
+      long ack_N;                   //!< Line number of the last numbered line done
+    #endif
+    #if ENABLED(MEATPACK_BINARY_FRAMES)
+      bool binary_frames;           //!< MeatPack sends binary frames from this port
+      float binary_fields[sizeof(MP_BINARY_FIELDS) - 1]; //!< Binary frame fields as of the last accepted frame
+    #endif
   };
 
   static SerialState serial_state[NUM_SERIAL]; //!< Serial states for each serial port
 
+  #if ENABLED(MEATPACK_BINARY_FRAMES)
+    // Called by MeatPack when binary frames are turned on. The frame that turns them off clears it.
+    static void binary_frames_on(const serial_index_t serial_ind) { serial_state[serial_ind.index].binary_frames = true; }
+  #endif
+
+  #if ENABLED(COMMAND_ARENA)
+    GCodeQueue() { clear(); } // Point the first command into the arena
+  #endif
+
   /**
    * G-Code Command Queue
    * A simple (circular) ring buffer of BUFSIZE command strings.
+   * With COMMAND_ARENA the strings share one buffer of COMMAND_ARENA_SIZE.
    *
    * Commands are copied into this buffer by the command injectors
    * (immediate, serial, sd card) and they are processed sequentially by
@@ -57,8 +80,15 @@ public:
    * command and hands off execution to individual handler functions.
    */
   struct CommandLine {
-    char buffer[MAX_CMD_SIZE];      //!< The command buffer
+    #if ENABLED(COMMAND_ARENA)
+      char *buffer;                 //!< The command, stored in the ring buffer arena
+    #else
+      char buffer[MAX_CMD_SIZE];    //!< The command buffer
+    #endif
     bool skip_ok;                   //!< Skip sending ok when command is processed?
+    #if ENABLED(SERIAL_ACK_WINDOW)
+      long line_N;                  //!< The line number the command was sent with, or -1
+    #endif
     #if HAS_MULTI_SERIAL
       serial_index_t port;          //!< Serial port the command was received on
     #endif
@@ -73,13 +103,44 @@ public:
             index_w;                //!< Ring buffer's write position
     CommandLine commands[BUFSIZE];  //!< The ring buffer of commands
 
+    #if ENABLED(COMMAND_ARENA)
+      /**
+       * Commands are written end-to-end in the arena. The command being written
+       * always has MAX_CMD_SIZE bytes before the end of the arena, so it starts
+       * over at 0 when the last command ends too close to the end.
+       */
+      uint16_t arena_w,               //!< Arena offset of the command being written
+               arena_end;             //!< Arena offset just past the last committed command
+      char arena[COMMAND_ARENA_SIZE]; //!< Command text storage
+
+      // Can the command being written have MAX_CMD_SIZE bytes without touching queued commands?
+      inline bool arena_room() const {
+        if (!length) return true;
+        const uint16_t r = commands[index_r].buffer - arena;
+        return r < arena_end ? (arena_w == arena_end || r >= MAX_CMD_SIZE)      // Queued commands are in one piece
+                             : (arena_w == arena_end && r - arena_end >= MAX_CMD_SIZE); // Queued commands wrap around
+      }
+
+      void commit_arena();
+    #endif
+
     inline serial_index_t command_port() const { return TERN0(HAS_MULTI_SERIAL, commands[index_r].port); }
 
-    inline void clear() { length = index_r = index_w = 0; }
+    inline void clear() {
+      length = index_r = index_w = 0;
+      #if ENABLED(COMMAND_ARENA)
+        arena_w = arena_end = 0;
+        commands[0].buffer = arena;
+      #endif
+    }
 
     void advance_pos(uint8_t &p, const int inc) { if (++p >= BUFSIZE) p = 0; length += inc; }
     inline void advance_w() { advance_pos(index_w, 1); }
-    inline void advance_r() { if (length) advance_pos(index_r, -1); }
+    inline void advance_r() {
+      if (!length) return;
+      advance_pos(index_r, -1);
+      TERN_(COMMAND_ARENA, commands[index_w].buffer = &arena[arena_w]);
+    }
 
     void commit_command(const bool skip_ok
       OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind=serial_index_t())
@@ -91,7 +152,9 @@ public:
 
     void ok_to_send();
 
-    inline bool full(uint8_t cmdCount=1) const { return length > (BUFSIZE - cmdCount); }
+    inline bool full(uint8_t cmdCount=1) const { return length > (BUFSIZE - cmdCount) || TERN0(COMMAND_ARENA, !arena_room()); }
+
+    uint8_t free_commands() const;
 
     inline bool occupied() const { return length != 0; }
 
@@ -203,6 +266,13 @@ public:
    */
   static void flush_and_request_resend(const serial_index_t serial_ind);
 
+  #if ENABLED(SERIAL_ACK_WINDOW)
+    /**
+     * Send one "ok N<line>" for the numbered lines held back by M577
+     */
+    static void flush_acks(const serial_index_t serial_ind);
+  #endif
+
   #if (defined(ARDUINO_ARCH_STM32F4) || defined(ARDUINO_ARCH_STM32)) && defined(USBCON)
     static void flush_rx();
   #else
@@ -267,6 +337,10 @@ private:
     static void get_sdcard_commands();
   #endif
 
+  #if ENABLED(BINARY_GCODE_STREAM)
+    static bool get_stream_commands();
+  #endif
+
   // Process the next "immediate" command (PROGMEM)
   static bool process_injected_command_P();
 
@@ -275,6 +349,12 @@ private:
 
   static void gcode_line_error(FSTR_P const ferr, const serial_index_t serial_ind);
 
+  static void queue_serial_command(char * const line, char * const command, const serial_index_t serial_ind);
+
+  #if ENABLED(MEATPACK_BINARY_FRAMES)
+    static bool binary_frame_done(const serial_index_t serial_ind);
+  #endif
+
   friend class GcodeSuite;
 };
 
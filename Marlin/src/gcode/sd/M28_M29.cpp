@@ -31,8 +31,16 @@
   #include "../queue.h"
 #endif
 
+#if ENABLED(BINARY_GCODE_STREAM)
+  #include "../../feature/binary_stream.h"
+#endif
+
 /**
  * M28: Start SD Write
+ *
+ *  B1 - Switch to the binary protocol (BINARY_FILE_TRANSFER).
+ *       With BINARY_GCODE_STREAM also report the stream buffers and
+ *       the totals of the last G-code stream.
  */
 void GcodeSuite::M28() {
 
@@ -50,6 +58,7 @@ void GcodeSuite::M28() {
     if ((card.flag.binary_mode = binary_mode)) {
       SERIAL_ECHO_MSG("Switching to Binary Protocol");
       TERN_(HAS_MULTI_SERIAL, card.transfer_port_index = queue.ring_buffer.command_port().index);
+      TERN_(BINARY_GCODE_STREAM, GCodeStreamProtocol::report());
     }
     else
       card.openFileWrite(p);
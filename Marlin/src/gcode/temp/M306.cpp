@@ -81,6 +81,7 @@ void GcodeSuite::M306() {
       if (parser.seenval('F')) mpc.applyFanAdjustment(parser.value_float());
     #endif
     if (parser.seenval('H')) mpc.filament_heat_capacity_permm = parser.value_float();
+    thermalManager.updateMPC();
     return;
   }
 
@@ -496,6 +496,9 @@
   #if ANY(DELTA, SEGMENT_LEVELED_MOVES)
     #define UBL_SEGMENTED 1
   #endif
+  #if UBL_SEGMENTED && defined(UBL_SEGMENT_BATCH)
+    #define HAS_PLANNER_BATCH 1
+  #endif
 #endif
 #if ANY(AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_3POINT)
   #define ABL_PLANAR 1
@@ -1495,6 +1495,9 @@
 #if ANY(MEATPACK_ON_SERIAL_PORT_1, MEATPACK_ON_SERIAL_PORT_2)
   #define HAS_MEATPACK 1
 #endif
+#if ANY(MEATPACK_BINARY_FRAMES, GCODE_PREPARSED_MOVES)
+  #define HAS_BINARY_COMMANDS 1
+#endif
 
 // AVR are (usually) too limited in resources to store the configuration into the binary
 #if ENABLED(CONFIGURATION_EMBEDDING) && !defined(FORCE_CONFIG_EMBED) && (defined(__AVR__) || !HAS_MEDIA || ANY(SDCARD_READONLY, DISABLE_M503))
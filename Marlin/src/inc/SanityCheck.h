@@ -888,6 +888,25 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #endif
 #endif
 
+/**
+ * Stepper Ramp Tables requirements
+ */
+#if ENABLED(STEPPER_RAMP_TABLES)
+  #ifndef CPU_32_BIT
+    #error "STEPPER_RAMP_TABLES requires a 32-bit CPU."
+  #elif ENABLED(S_CURVE_ACCELERATION)
+    #error "STEPPER_RAMP_TABLES is not compatible with S_CURVE_ACCELERATION."
+  #elif ENABLED(LIN_ADVANCE)
+    #error "STEPPER_RAMP_TABLES is not compatible with LIN_ADVANCE."
+  #elif ENABLED(NONLINEAR_EXTRUSION)
+    #error "STEPPER_RAMP_TABLES is not compatible with NONLINEAR_EXTRUSION."
+  #elif ENABLED(OLD_ADAPTIVE_MULTISTEPPING)
+    #error "STEPPER_RAMP_TABLES is not compatible with OLD_ADAPTIVE_MULTISTEPPING."
+  #elif !WITHIN(RAMP_TABLE_SEGMENTS, 1, 32)
+    #error "RAMP_TABLE_SEGMENTS must be from 1 to 32."
+  #endif
+#endif
+
 /**
  * Special tool-changing options
  */
@@ -1229,6 +1248,9 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
       #error "DELTA requires GRID_MAX_POINTS_X and GRID_MAX_POINTS_Y to be 3 or higher."
     #endif
   #endif
+  #if ENABLED(DELTA_FAST_IK)
+    static_assert(WITHIN(DELTA_FAST_IK_TOLERANCE, 0.00001, 0.01), "DELTA_FAST_IK_TOLERANCE must be between 0.00001 and 0.01.");
+  #endif
 #endif
 
 /**
@@ -1673,6 +1695,10 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
     #error "GRID_MAX_POINTS_[XY] must be between 3 and 255."
   #elif ALL(UBL_HILBERT_CURVE, DELTA)
     #error "UBL_HILBERT_CURVE can only be used with a square / rectangular printable area."
+  #elif defined(UBL_SEGMENT_BATCH) && !UBL_SEGMENTED
+    #error "UBL_SEGMENT_BATCH requires DELTA or SEGMENT_LEVELED_MOVES."
+  #elif defined(UBL_SEGMENT_BATCH) && !WITHIN(UBL_SEGMENT_BATCH, 2, (BLOCK_BUFFER_SIZE) / 2)
+    #error "UBL_SEGMENT_BATCH must be from 2 to half of BLOCK_BUFFER_SIZE."
   #endif
 #elif ENABLED(MESH_BED_LEVELING)
   #if ENABLED(DELTA)
@@ -2085,6 +2111,14 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #error "TEMP_SENSOR_REDUNDANT 1000 requires REDUNDANT_PULLUP_RESISTOR_OHMS, REDUNDANT_RESISTANCE_25C_OHMS and REDUNDANT_BETA in Configuration_adv.h."
 #endif
 
+#if ENABLED(USER_THERMISTOR_LUT)
+  #if !HAS_USER_THERMISTORS
+    #error "USER_THERMISTOR_LUT requires at least one custom (1000) thermistor."
+  #elif !WITHIN(USER_THERMISTOR_LUT_BITS, 2, 5)
+    #error "USER_THERMISTOR_LUT_BITS must be from 2 to 5."
+  #endif
+#endif
+
 /**
  * Required thermistor 66 (Dyze Design / Trianglelab T-D500) settings
  * https://docs.dyzedesign.com/hotends.html#_500-%C2%B0c-thermistor
@@ -2790,6 +2824,22 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #endif
 #endif
 
+#ifdef SDCARD_READ_BUFFER_SIZE
+  #if !HAS_MEDIA
+    #error "SDCARD_READ_BUFFER_SIZE requires an SD card or USB flash drive."
+  #elif SDCARD_READ_BUFFER_SIZE < 512 || SDCARD_READ_BUFFER_SIZE > 16384 || SDCARD_READ_BUFFER_SIZE % 512
+    #error "SDCARD_READ_BUFFER_SIZE must be a multiple of 512, no larger than 16384."
+  #endif
+#endif
+
+#if ENABLED(SD_READ_AHEAD)
+  #if !HAS_MEDIA
+    #error "SD_READ_AHEAD requires an SD card or USB flash drive."
+  #elif !WITHIN(SD_CLUSTER_EXTENTS, 1, 255)
+    #error "SD_CLUSTER_EXTENTS must be between 1 and 255."
+  #endif
+#endif
+
 #if ENABLED(SD_IGNORE_AT_STARTUP)
   #if ENABLED(POWER_LOSS_RECOVERY)
     #error "SD_IGNORE_AT_STARTUP is incompatible with POWER_LOSS_RECOVERY."
@@ -3913,6 +3963,8 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
     #error "POWER_LOSS_RECOVER_ZHOME is not needed on a machine that homes to ZMAX."
   #elif ALL(IS_CARTESIAN, POWER_LOSS_RECOVER_ZHOME) && Z_HOME_TO_MIN && !defined(POWER_LOSS_ZHOME_POS)
     #error "POWER_LOSS_RECOVER_ZHOME requires POWER_LOSS_ZHOME_POS for a Cartesian that homes to ZMIN."
+  #elif ENABLED(POWER_LOSS_JOURNAL) && !WITHIN(POWER_LOSS_JOURNAL_SIZE, 1, 255)
+    #error "POWER_LOSS_JOURNAL_SIZE must be from 1 to 255."
   #endif
 #endif
 
@@ -4264,12 +4316,40 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #endif
 #endif
 
+/**
+ * Command queue arena
+ */
+#if ENABLED(COMMAND_ARENA)
+  static_assert(BUFSIZE <= 255, "BUFSIZE must be 255 or less.");
+  static_assert(WITHIN(COMMAND_ARENA_SIZE, 2 * (MAX_CMD_SIZE), 65535), "COMMAND_ARENA_SIZE must be from 2 * MAX_CMD_SIZE to 65535.");
+#endif
+
+/**
+ * G-code profiler slots
+ */
+#if ENABLED(GCODE_PROFILER)
+  static_assert(WITHIN(GCODE_PROFILER_SLOTS, 1, 255), "GCODE_PROFILER_SLOTS must be from 1 to 255.");
+#endif
+
 /**
  * Sanity Check for MEATPACK and BINARY_FILE_TRANSFER Features
  */
 #if ALL(HAS_MEATPACK, BINARY_FILE_TRANSFER)
   #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
 #endif
+#if ENABLED(BINARY_GCODE_STREAM) && DISABLED(BINARY_FILE_TRANSFER)
+  #error "BINARY_GCODE_STREAM requires BINARY_FILE_TRANSFER."
+#endif
+#if ENABLED(MEATPACK_BINARY_FRAMES)
+  #if !HAS_MEATPACK
+    #error "MEATPACK_BINARY_FRAMES requires MEATPACK_ON_SERIAL_PORT_1 or MEATPACK_ON_SERIAL_PORT_2."
+  #elif DISABLED(FASTER_GCODE_PARSER)
+    #error "MEATPACK_BINARY_FRAMES requires FASTER_GCODE_PARSER."
+  #endif
+#endif
+#if ENABLED(GCODE_PREPARSED_MOVES) && DISABLED(FASTER_GCODE_PARSER)
+  #error "GCODE_PREPARSED_MOVES requires FASTER_GCODE_PARSER."
+#endif
 
 /**
  * Sanity Check for Slim LCD Menus and Probe Offset Wizard
@@ -4488,12 +4568,19 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
  * Direct Stepping requirements
  */
 #if ENABLED(DIRECT_STEPPING)
-  #ifdef CPU_32_BIT
+  #if defined(CPU_32_BIT) && !defined(UNIT_TEST) // Unit tests run the media page manager natively
     #error "Direct Stepping is not supported on 32-bit boards."
   #elif !IS_FULL_CARTESIAN
     #error "Direct Stepping is incompatible with enabled kinematics."
   #endif
 #endif
+#if ENABLED(DIRECT_STEPPING_FILES)
+  #if DISABLED(DIRECT_STEPPING)
+    #error "DIRECT_STEPPING_FILES requires DIRECT_STEPPING."
+  #elif !HAS_MEDIA
+    #error "DIRECT_STEPPING_FILES requires an SD card or USB flash drive."
+  #endif
+#endif
 
 /**
  * Input Shaping requirements
@@ -4580,6 +4667,7 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #elif DISABLED(FTM_UNIFIED_BWS)
     #error "FT_MOTION requires FTM_UNIFIED_BWS to be enabled because FBS is not yet implemented."
   #endif
+  static_assert(FTM_STEPS_PER_UNIT_TIME >= 1 && FTM_STEPS_PER_UNIT_TIME <= 255, "FTM_STEPPER_FS / FTM_FS must be from 1 to 255.");
   #if !HAS_X_AXIS
     static_assert(FTM_DEFAULT_SHAPER_X != ftMotionShaper_NONE, "Without any linear axes FTM_DEFAULT_SHAPER_X must be ftMotionShaper_NONE.");
   #endif
@@ -4590,6 +4678,19 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
     static_assert(FTM_DEFAULT_DYNFREQ_MODE != dynFreqMode_MASS_BASED, "dynFreqMode_MASS_BASED requires an X axis and an extruder.");
   #endif
 #endif
+#if ENABLED(FTM_ARC_BLOCKS)
+  #if DISABLED(FT_MOTION)
+    #error "FTM_ARC_BLOCKS requires FT_MOTION."
+  #elif DISABLED(ARC_SUPPORT)
+    #error "FTM_ARC_BLOCKS requires ARC_SUPPORT."
+  #elif ANY(IS_KINEMATIC, IS_CORE, MARKFORGED_XY, MARKFORGED_YX)
+    #error "FTM_ARC_BLOCKS requires a Cartesian machine."
+  #elif ENABLED(CLASSIC_JERK)
+    #error "FTM_ARC_BLOCKS requires Junction Deviation. Disable CLASSIC_JERK."
+  #elif ENABLED(SKEW_CORRECTION)
+    #error "FTM_ARC_BLOCKS is not compatible with SKEW_CORRECTION."
+  #endif
+#endif
 
 // Multi-Stepping Limit
 static_assert(WITHIN(MULTISTEPPING_LIMIT, 1, 128) && IS_POWER_OF_2(MULTISTEPPING_LIMIT), "MULTISTEPPING_LIMIT must be 1, 2, 4, 8, 16, 32, 64, or 128.");
@@ -4615,6 +4716,28 @@ static_assert(WITHIN(MULTISTEPPING_LIMIT, 1, 128) && IS_POWER_OF_2(MULTISTEPPING
   #error "CONFIGURABLE_MACHINE_NAME requires GCODE_QUOTED_STRINGS."
 #endif
 
+#if ENABLED(PLANNER_BENCHMARK) && !defined(__PLAT_LINUX__)
+  #error "PLANNER_BENCHMARK is only supported by the linux_native_benchmark environment."
+#endif
+
+#if ENABLED(ADC_SCAN_MODE) && !defined(__STM32F1__) && !defined(__PLAT_LINUX__) && !defined(__PLAT_NATIVE_SIM__)
+  #error "ADC_SCAN_MODE is not yet supported by this HAL."
+#endif
+
+#if ENABLED(EEPROM_LOG_STORE)
+  #ifdef __STM32F1__
+    #if DISABLED(FLASH_EEPROM_EMULATION)
+      #error "EEPROM_LOG_STORE requires FLASH_EEPROM_EMULATION on STM32F1."
+    #endif
+  #elif !defined(__PLAT_LINUX__)
+    #error "EEPROM_LOG_STORE is not yet supported by this HAL."
+  #endif
+#endif
+
+#if ALL(SOFT_PWM_SCHEDULE, SLOW_PWM_HEATERS)
+  #error "SOFT_PWM_SCHEDULE is not compatible with SLOW_PWM_HEATERS."
+#endif
+
 // Misc. Cleanup
 #undef _TEST_PWM
 #undef _NUM_AXES_STR
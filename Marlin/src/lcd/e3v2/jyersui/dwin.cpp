@@ -2273,7 +2273,7 @@ void JyersDWIN::menuItemHandler(const uint8_t menu, const uint8_t item, bool dra
                 drawFloat(thermalManager.temp_hotend[0].mpc.heater_power, row, false, 1);
               }
               else
-                modifyValue(thermalManager.temp_hotend[0].mpc.heater_power, 1, 200, 1);
+                modifyValue(thermalManager.temp_hotend[0].mpc.heater_power, 1, 200, 1, thermalManager.updateMPC);
               break;
 
             case MPCMENU_BLOCK_HEAT_CAPACITY:
@@ -2282,7 +2282,7 @@ void JyersDWIN::menuItemHandler(const uint8_t menu, const uint8_t item, bool dra
                 drawFloat(thermalManager.temp_hotend[0].mpc.block_heat_capacity, row, false, 100);
               }
               else
-                modifyValue(thermalManager.temp_hotend[0].mpc.block_heat_capacity, 0, 40, 100);
+                modifyValue(thermalManager.temp_hotend[0].mpc.block_heat_capacity, 0, 40, 100, thermalManager.updateMPC);
               break;
 
             case MPCMENU_SENSOR_RESPONSIVENESS:
@@ -2291,7 +2291,7 @@ void JyersDWIN::menuItemHandler(const uint8_t menu, const uint8_t item, bool dra
                 drawFloat(thermalManager.temp_hotend[0].mpc.sensor_responsiveness, row, false, 10000);
               }
               else
-                modifyValue(thermalManager.temp_hotend[0].mpc.sensor_responsiveness, 0, 1, 10000);
+                modifyValue(thermalManager.temp_hotend[0].mpc.sensor_responsiveness, 0, 1, 10000, thermalManager.updateMPC);
               break;
 
             case MPCMENU_AMBIENT_XFER_COEFF:
@@ -2300,7 +2300,7 @@ void JyersDWIN::menuItemHandler(const uint8_t menu, const uint8_t item, bool dra
                 drawFloat(thermalManager.temp_hotend[0].mpc.ambient_xfer_coeff_fan0, row, false, 10000);
               }
               else
-                modifyValue(thermalManager.temp_hotend[0].mpc.ambient_xfer_coeff_fan0, 0, 1, 10000);
+                modifyValue(thermalManager.temp_hotend[0].mpc.ambient_xfer_coeff_fan0, 0, 1, 10000, thermalManager.updateMPC);
               break;
 
             #if ENABLED(MPC_INCLUDE_FAN)
@@ -4021,10 +4021,10 @@ void drawMaxAccelMenu() {
 #if ANY(MPC_EDIT_MENU, MPC_AUTOTUNE_MENU)
 
   #if ENABLED(MPC_EDIT_MENU)
-    void setHeaterPower() { setPFloatOnClick(1, 200, 1); }
-    void setBlkHeatCapacity() { setPFloatOnClick(0, 40, 2); }
-    void setSensorResponse() { setPFloatOnClick(0, 1, 4); }
-    void setAmbientXfer() { setPFloatOnClick(0, 1, 4); }
+    void setHeaterPower() { setPFloatOnClick(1, 200, 1, thermalManager.updateMPC); }
+    void setBlkHeatCapacity() { setPFloatOnClick(0, 40, 2, thermalManager.updateMPC); }
+    void setSensorResponse() { setPFloatOnClick(0, 1, 4, thermalManager.updateMPC); }
+    void setAmbientXfer() { setPFloatOnClick(0, 1, 4, thermalManager.updateMPC); }
     #if ENABLED(MPC_INCLUDE_FAN)
       void onDrawFanAdj(MenuItem* menuitem, int8_t line) { onDrawFloatMenu(menuitem, line, 4, thermalManager.temp_hotend[0].fanCoefficient()); }
       void applyFanAdj() { thermalManager.temp_hotend[0].applyFanAdjustment(menuData.value / POW(10, 4)); }
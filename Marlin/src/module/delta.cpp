@@ -60,6 +60,9 @@ xy_float_t delta_tower[ABC];
 abc_float_t delta_diagonal_rod_2_tower;
 float delta_clip_start_height = Z_MAX_POS;
 abc_float_t delta_diagonal_rod_trim;
+#if ENABLED(DELTA_FAST_IK)
+  delta_ik_tower_t delta_ik_tower[ABC];
+#endif
 
 float delta_safe_distance_from_top();
 
@@ -85,6 +88,15 @@ void recalc_delta_settings() {
   delta_diagonal_rod_2_tower.set(sq(delta_diagonal_rod + delta_diagonal_rod_trim.a),
                                  sq(delta_diagonal_rod + delta_diagonal_rod_trim.b),
                                  sq(delta_diagonal_rod + delta_diagonal_rod_trim.c));
+  #if ENABLED(DELTA_FAST_IK)
+    LOOP_ABC(i) {
+      delta_ik_tower_t &t = delta_ik_tower[i];
+      t.pos = delta_tower[i];
+      t.rod2 = delta_diagonal_rod_2_tower[i];
+      t.height = SQRT(t.rod2 - HYPOT2(t.pos.x, t.pos.y)); // Start with the effector centered
+      t.inv2h = 0.5f / t.height;
+    }
+  #endif
   update_software_endstops(Z_AXIS);
   set_all_unhomed();
 }
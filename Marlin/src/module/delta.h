@@ -79,7 +79,46 @@ void recalc_delta_settings();
     )                                     \
   )
 
-#define DELTA_IK(V) delta.set(DELTA_Z(V, A_AXIS), DELTA_Z(V, B_AXIS), DELTA_Z(V, C_AXIS))
+#if ENABLED(DELTA_FAST_IK)
+
+  /**
+   * Tower terms for the fast inverse kinematics, cached together for each tower.
+   * Carriage heights change little from one segment to the next, so a single
+   * Newton step from the last height h replaces the square root. For a step of
+   * d = (r - h²) / 2h the result is high by 2hd² / (h + √r)², which is under
+   * 1.375 d² / 2h while |d| < h/4. Beyond DELTA_FAST_IK_TOLERANCE, or for a
+   * longer step, the exact square root is taken instead.
+   */
+  typedef struct {
+    xy_float_t pos;   // (mm) Tower XY position
+    float rod2,       // (mm²) Diagonal rod length squared
+          height,     // (mm) Last carriage height above the effector
+          inv2h;      // 0.5 / height
+  } delta_ik_tower_t;
+
+  extern delta_ik_tower_t delta_ik_tower[ABC];
+
+  FORCE_INLINE float delta_fast_tower_z(delta_ik_tower_t &t, const xyz_pos_t &v) {
+    const float r = t.rod2 - HYPOT2(t.pos.x - v.x, t.pos.y - v.y),
+                d = (r - sq(t.height)) * t.inv2h;
+    if (ABS(d * t.inv2h) < 0.125f && sq(d) * t.inv2h * 1.375f < float(DELTA_FAST_IK_TOLERANCE)) {
+      t.height += d;
+      t.inv2h *= 2.0f - 2.0f * t.height * t.inv2h; // Newton step toward the new reciprocal
+    }
+    else {
+      t.height = SQRT(r);
+      t.inv2h = 0.5f / t.height;
+    }
+    return v.z + t.height;
+  }
+
+  #define DELTA_IK(V) delta.set(delta_fast_tower_z(delta_ik_tower[A_AXIS], V), delta_fast_tower_z(delta_ik_tower[B_AXIS], V), delta_fast_tower_z(delta_ik_tower[C_AXIS], V))
+
+#else
+
+  #define DELTA_IK(V) delta.set(DELTA_Z(V, A_AXIS), DELTA_Z(V, B_AXIS), DELTA_Z(V, C_AXIS))
+
+#endif
 
 void inverse_kinematics(const xyz_pos_t &raw);
 
@@ -38,9 +38,11 @@ FTMotion ftMotion;
 
 ft_config_t FTMotion::cfg;
 bool FTMotion::busy; // = false
-ft_command_t FTMotion::stepperCmdBuff[FTM_STEPPERCMD_BUFF_SIZE] = {0U}; // Stepper commands buffer.
-int32_t FTMotion::stepperCmdBuff_produceIdx = 0, // Index of next stepper command write to the buffer.
-        FTMotion::stepperCmdBuff_consumeIdx = 0; // Index of next stepper command read from the buffer.
+uint8_t FTMotion::stepperCmdBuff[FTM_STEPPERCMD_BUFF_BYTES] = {0U}; // Packed stepper commands buffer.
+int32_t FTMotion::stepperCmdBuff_produceIdx = 0, // Index of next byte write to the buffer.
+        FTMotion::stepperCmdBuff_consumeIdx = 0; // Index of next byte read from the buffer.
+uint32_t FTMotion::stepperCmdBuff_produced = 0,  // Count of stepper commands written to the buffer.
+         FTMotion::stepperCmdBuff_consumed = 0;  // Count of stepper commands read from the buffer.
 
 bool FTMotion::sts_stepperBusy = false;         // The stepper buffer has items and is in use.
 
@@ -67,6 +69,10 @@ bool FTMotion::batchRdyForInterp = false;       // Indicates the batch is done b
 xyze_pos_t   FTMotion::startPosn,                     // (mm) Start position of block
              FTMotion::endPosn_prevBlock = { 0.0f };  // (mm) End position of previous block
 xyze_float_t FTMotion::ratio;                         // (ratio) Axis move ratio of block
+#if ENABLED(FTM_ARC_BLOCKS)
+  block_arc_t FTMotion::arc;                          // Arc of the block, if any
+  float FTMotion::arc_rad_per_mm;                     // (rad/mm) Angular travel per mm along the block
+#endif
 float FTMotion::accel_P,                        // Acceleration prime of block. [mm/sec/sec]
       FTMotion::decel_P,                        // Deceleration prime of block. [mm/sec/sec]
       FTMotion::F_P,                            // Feedrate prime of block. [mm/sec]
@@ -86,13 +92,14 @@ uint32_t FTMotion::makeVector_idx = 0,          // Index of fixed time trajector
 
 // Interpolation variables.
 xyze_long_t FTMotion::steps = { 0 };            // Step count accumulator.
+FTMotion::cmd_frame_t FTMotion::cmdFrame;       // = { 0 } Unpacking state of the current command frame.
 
 uint32_t FTMotion::interpIdx = 0;               // Index of current data point being interpolated.
 
 // Shaping variables.
 #if HAS_FTM_SHAPING
   FTMotion::shaping_t FTMotion::shaping = {
-    zi_idx: 0
+    zi_idx: FTM_ZMAX
     #if HAS_X_AXIS
       , x:{ false, { 0.0f }, { 0.0f }, { 0 }, 0 } // ena, d_zi[], Ai[], Ni[], max_i
     #endif
@@ -199,7 +206,8 @@ void FTMotion::loop() {
 
   // Interpolation (generation of step commands from fixed time trajectory).
   while (batchRdyForInterp
-    && (stepperCmdBuffItems() < (FTM_STEPPERCMD_BUFF_SIZE) - (FTM_STEPS_PER_UNIT_TIME))) {
+    && (stepperCmdBuffItems() < (FTM_STEPPERCMD_BUFF_SIZE) - (FTM_STEPS_PER_UNIT_TIME))
+    && (stepperCmdBuffFree() >= int32_t(FTM_CMD_FRAME_MAX))) {
     convertToSteps(interpIdx);
     if (++interpIdx == FTM_BATCH_SIZE) {
       batchRdyForInterp = false;
@@ -348,6 +356,24 @@ void FTMotion::loop() {
     }
   }
 
+  /**
+   * Shape 'n' consecutive data points in place, appending the raw points
+   * to the delay line at 'zi'. Each shaper tap is a multiply-add over a
+   * contiguous run of the delay line, so the loops can be vectorized.
+   */
+  void FTMotion::AxisShaping::shape(float * const __restrict pts, const uint32_t zi, const uint32_t n) {
+    float * const __restrict d = &d_zi[zi];
+    for (uint32_t k = 0; k < n; ++k) {
+      d[k] = pts[k];
+      pts[k] *= Ai[0];
+    }
+    for (uint32_t i = 1U; i <= max_i; ++i) {
+      const float a = Ai[i];
+      const float * const __restrict src = d - Ni[i];
+      for (uint32_t k = 0; k < n; ++k) pts[k] += a * src[k];
+    }
+  }
+
   void FTMotion::update_shaping_params() {
     #if HAS_X_AXIS
       if ((shaping.x.ena = AXIS_HAS_SHAPER(X))) {
@@ -369,12 +395,15 @@ void FTMotion::loop() {
 void FTMotion::reset() {
 
   stepperCmdBuff_produceIdx = stepperCmdBuff_consumeIdx = 0;
+  stepperCmdBuff_produced = stepperCmdBuff_consumed = 0;
+  cmdFrame.ticks = 0;
 
   traj.reset();
 
   blockProcRdy = batchRdy = batchRdyForInterp = false;
 
   endPosn_prevBlock.reset();
+  TERN_(FTM_ARC_BLOCKS, arc.angle = 0);
 
   makeVector_idx = 0;
   makeVector_batchIdx = TERN(FTM_UNIFIED_BWS, 0, _MIN(BATCH_SIDX_IN_WINDOW, FTM_BATCH_SIZE));
@@ -385,7 +414,7 @@ void FTMotion::reset() {
   #if HAS_FTM_SHAPING
     TERN_(HAS_X_AXIS, ZERO(shaping.x.d_zi));
     TERN_(HAS_Y_AXIS, ZERO(shaping.y.d_zi));
-    shaping.zi_idx = 0;
+    shaping.zi_idx = FTM_ZMAX;
   #endif
 
   TERN_(HAS_EXTRUDERS, e_raw_z1 = e_advanced_z1 = 0.0f);
@@ -419,6 +448,7 @@ void FTMotion::runoutBlock() {
 
   startPosn = endPosn_prevBlock;
   ratio.reset();
+  TERN_(FTM_ARC_BLOCKS, arc.angle = 0);
 
   const int32_t n_to_fill_batch = (FTM_WINDOW_SIZE) - makeVector_batchIdx;
 
@@ -441,8 +471,13 @@ void FTMotion::runoutBlock() {
 
 // Auxiliary function to get number of step commands in the buffer.
 int32_t FTMotion::stepperCmdBuffItems() {
-  const int32_t udiff = stepperCmdBuff_produceIdx - stepperCmdBuff_consumeIdx;
-  return (udiff < 0) ? udiff + (FTM_STEPPERCMD_BUFF_SIZE) : udiff;
+  return int32_t(stepperCmdBuff_produced - stepperCmdBuff_consumed);
+}
+
+// Auxiliary function to get number of free bytes in the buffer.
+int32_t FTMotion::stepperCmdBuffFree() {
+  const int32_t udiff = stepperCmdBuff_consumeIdx - stepperCmdBuff_produceIdx - 1;
+  return (udiff < 0) ? udiff + (FTM_STEPPERCMD_BUFF_BYTES) : udiff;
 }
 
 // Initializes storage variables before startup.
@@ -473,6 +508,18 @@ void FTMotion::loadBlockData(block_t * const current_block) {
 
   ratio = moveDist * oneOverLength;
 
+  #if ENABLED(FTM_ARC_BLOCKS)
+    arc = current_block->arc;
+    if (arc.angle) {
+      // The plane axes follow the arc. What's left of their ratios
+      // only spreads the step rounding of the end point over the block.
+      const float c = cos(arc.angle), s = sin(arc.angle);
+      ratio[arc.axis_p] = (moveDist[arc.axis_p] - (arc.rvec.a * (c - 1.0f) - arc.rvec.b * s)) * oneOverLength;
+      ratio[arc.axis_q] = (moveDist[arc.axis_q] - (arc.rvec.a * s + arc.rvec.b * (c - 1.0f))) * oneOverLength;
+      arc_rad_per_mm = arc.angle * oneOverLength;
+    }
+  #endif
+
   const float spm = totalLength / current_block->step_event_count;  // (steps/mm) Distance for each step
 
   f_s = spm * current_block->initial_rate;              // (steps/s) Start feedrate
@@ -576,8 +623,32 @@ void FTMotion::loadBlockData(block_t * const current_block) {
 
 }
 
+#if HAS_FTM_SHAPING
+
+  // Apply shaping, if active on each axis, to 'n' data points starting at 'start'
+  void FTMotion::shapeVector(const uint32_t start, const uint32_t n) {
+    // Keep only the last FTM_ZMAX points of history when the delay lines are full
+    if (shaping.zi_idx + n > COUNT(shaping.x.d_zi)) {
+      const uint32_t from = shaping.zi_idx - (FTM_ZMAX);
+      TERN_(HAS_X_AXIS, memmove(shaping.x.d_zi, &shaping.x.d_zi[from], (FTM_ZMAX) * sizeof(float)));
+      TERN_(HAS_Y_AXIS, memmove(shaping.y.d_zi, &shaping.y.d_zi[from], (FTM_ZMAX) * sizeof(float)));
+      shaping.zi_idx = FTM_ZMAX;
+    }
+    TERN_(HAS_X_AXIS, if (shaping.x.ena) shaping.x.shape(&traj.x[start], shaping.zi_idx, n));
+    TERN_(HAS_Y_AXIS, if (shaping.y.ena) shaping.y.shape(&traj.y[start], shaping.zi_idx, n));
+    shaping.zi_idx += n;
+  }
+
+#endif
+
 // Generate data points of the trajectory.
 void FTMotion::makeVector() {
+  #if HAS_FTM_SHAPING
+    // With fixed shaper parameters all new points are shaped in one pass
+    const bool batch_shaping = cfg.dynFreqMode == dynFreqMode_DISABLED;
+    const uint32_t batch_start = makeVector_batchIdx;
+  #endif
+
   do {
     float accel_k = 0.0f;                                 // (mm/s^2) Acceleration K factor
     float tau = (makeVector_idx + 1) * (FTM_TS);          // (s) Time since start of block
@@ -603,6 +674,15 @@ void FTMotion::makeVector() {
     #define _SET_TRAJ(q) traj.q[makeVector_batchIdx] = startPosn.q + ratio.q * dist;
     LOGICAL_AXIS_MAP_LC(_SET_TRAJ);
 
+    #if ENABLED(FTM_ARC_BLOCKS)
+      if (arc.angle) {
+        // Rotate the start position about the center of the arc
+        const float theta = arc_rad_per_mm * dist, c = cos(theta), s = sin(theta);
+        traj.data[arc.axis_p][makeVector_batchIdx] += arc.rvec.a * (c - 1.0f) - arc.rvec.b * s;
+        traj.data[arc.axis_q][makeVector_batchIdx] += arc.rvec.a * s + arc.rvec.b * (c - 1.0f);
+      }
+    #endif
+
     #if HAS_EXTRUDERS
       if (cfg.linearAdvEna) {
         float dedt_adj = (traj.e[makeVector_batchIdx] - e_raw_z1) * (FTM_FS);
@@ -652,31 +732,8 @@ void FTMotion::makeVector() {
       default: break;
     }
 
-    // Apply shaping if active on each axis
-    #if HAS_FTM_SHAPING
-      #if HAS_X_AXIS
-        if (shaping.x.ena) {
-          shaping.x.d_zi[shaping.zi_idx] = traj.x[makeVector_batchIdx];
-          traj.x[makeVector_batchIdx] *= shaping.x.Ai[0];
-          for (uint32_t i = 1U; i <= shaping.x.max_i; i++) {
-            const uint32_t udiffx = shaping.zi_idx - shaping.x.Ni[i];
-            traj.x[makeVector_batchIdx] += shaping.x.Ai[i] * shaping.x.d_zi[shaping.x.Ni[i] > shaping.zi_idx ? (FTM_ZMAX) + udiffx : udiffx];
-          }
-        }
-      #endif
-
-      #if HAS_Y_AXIS
-        if (shaping.y.ena) {
-          shaping.y.d_zi[shaping.zi_idx] = traj.y[makeVector_batchIdx];
-          traj.y[makeVector_batchIdx] *= shaping.y.Ai[0];
-          for (uint32_t i = 1U; i <= shaping.y.max_i; i++) {
-            const uint32_t udiffy = shaping.zi_idx - shaping.y.Ni[i];
-            traj.y[makeVector_batchIdx] += shaping.y.Ai[i] * shaping.y.d_zi[shaping.y.Ni[i] > shaping.zi_idx ? (FTM_ZMAX) + udiffy : udiffy];
-          }
-        }
-      #endif
-      if (++shaping.zi_idx == (FTM_ZMAX)) shaping.zi_idx = 0;
-    #endif // HAS_FTM_SHAPING
+    // Dynamic frequency can change the shapers on every point
+    TERN_(HAS_FTM_SHAPING, if (!batch_shaping) shapeVector(makeVector_batchIdx, 1));
 
     // Filled up the queue with regular and shaped steps
     if (++makeVector_batchIdx == FTM_WINDOW_SIZE) {
@@ -689,24 +746,29 @@ void FTMotion::makeVector() {
       makeVector_idx = 0;
     }
   } while (blockProcRdy && !batchRdy);
+
+  #if HAS_FTM_SHAPING
+    if (batch_shaping) shapeVector(batch_start, (batchRdy ? FTM_WINDOW_SIZE : makeVector_batchIdx) - batch_start);
+  #endif
 }
 
 /**
  * Convert to steps
- * - Commands are written in a bitmask with step and dir as single bits.
+ * - Commands are generated as a bitmask with step bits for all axes.
  * - Tests for delta are moved outside the loop.
  * - Two functions are used for command computation with an array of function pointers.
+ * - The frame of commands is then packed into the buffer. See ft_motion.h.
  */
-static void (*command_set[LOGICAL_AXES])(int32_t&, int32_t&, ft_command_t&, int32_t, int32_t);
+static void (*command_set[LOGICAL_AXES])(int32_t&, int32_t&, ft_command_t&, const ft_command_t);
 
-static void command_set_pos(int32_t &e, int32_t &s, ft_command_t &b, int32_t bd, int32_t bs) {
+static void command_set_pos(int32_t &e, int32_t &s, ft_command_t &b, const ft_command_t bs) {
   if (e < FTM_CTS_COMPARE_VAL) return;
   s++;
-  b |= bd | bs;
+  b |= bs;
   e -= FTM_STEPS_PER_UNIT_TIME;
 }
 
-static void command_set_neg(int32_t &e, int32_t &s, ft_command_t &b, int32_t bd, int32_t bs) {
+static void command_set_neg(int32_t &e, int32_t &s, ft_command_t &b, const ft_command_t bs) {
   if (e > -(FTM_CTS_COMPARE_VAL)) return;
   s--;
   b |= bs;
@@ -737,28 +799,66 @@ void FTMotion::convertToSteps(const uint32_t idx) {
     );
   #endif
 
-  #define _COMMAND_SET(AXIS) command_set[_AXIS(AXIS)] = delta[_AXIS(AXIS)] >= 0 ? command_set_pos : command_set_neg;
+  // Direction bits are set for forward motion
+  ft_command_t dir = 0;
+  #define _COMMAND_SET(AXIS) do{ \
+    const bool fwd = delta[_AXIS(AXIS)] >= 0; \
+    command_set[_AXIS(AXIS)] = fwd ? command_set_pos : command_set_neg; \
+    if (fwd) dir |= _BV(FT_BIT_##AXIS); \
+  }while(0);
   LOGICAL_AXIS_MAP(_COMMAND_SET);
 
+  ft_command_t cmds[FTM_STEPS_PER_UNIT_TIME], mask = 0;
   for (uint32_t i = 0U; i < (FTM_STEPS_PER_UNIT_TIME); i++) {
 
-    ft_command_t &cmd = stepperCmdBuff[stepperCmdBuff_produceIdx];
+    ft_command_t &cmd = cmds[i];
 
-    // Init all step/dir bits to 0 (defaulting to reverse/negative motion)
+    // Init all step bits to 0
     cmd = 0;
 
     // Accumulate the errors for all axes
     err_P += delta;
 
-    // Set up step/dir bits for all axes
-    #define _COMMAND_RUN(A) command_set[_AXIS(A)](err_P.A, steps.A, cmd, _BV(FT_BIT_DIR_##A), _BV(FT_BIT_STEP_##A));
+    // Set up step bits for all axes
+    #define _COMMAND_RUN(A) command_set[_AXIS(A)](err_P.A, steps.A, cmd, _BV(FT_BIT_##A));
     LOGICAL_AXIS_MAP(_COMMAND_RUN);
 
-    // Next circular buffer index
-    if (++stepperCmdBuff_produceIdx == (FTM_STEPPERCMD_BUFF_SIZE))
-      stepperCmdBuff_produceIdx = 0;
+    mask |= cmd;
 
   } // FTM_STEPS_PER_UNIT_TIME loop
+
+  // Write the frame past the last published byte
+  int32_t w = stepperCmdBuff_produceIdx;
+  auto write_byte = [&w](const uint8_t b) {
+    stepperCmdBuff[w] = b;
+    if (++w == (FTM_STEPPERCMD_BUFF_BYTES)) w = 0;
+  };
+  auto write_word = [&](const ft_command_t v) {
+    write_byte(uint8_t(v));
+    if (sizeof(ft_command_t) > 1) write_byte(uint8_t(v >> 8));
+  };
+
+  write_word(mask);
+  if (mask) {
+    write_word(dir & mask);
+
+    // Pack the step bits of only the axes in the mask
+    const uint8_t bits = __builtin_popcount(mask);
+    uint32_t acc = 0;
+    uint8_t acc_bits = 0;
+    for (uint32_t i = 0U; i < (FTM_STEPS_PER_UNIT_TIME); i++) {
+      uint32_t packed = 0, b = 1;
+      for (ft_command_t m = mask; m; m &= m - 1, b <<= 1)
+        if (cmds[i] & m & -m) packed |= b;
+      acc |= packed << acc_bits;
+      for (acc_bits += bits; acc_bits >= 8; acc_bits -= 8, acc >>= 8) write_byte(uint8_t(acc));
+    }
+    if (acc_bits) write_byte(uint8_t(acc));
+  }
+
+  // Publish the frame to the Stepper ISR
+  stepperCmdBuff_produced += FTM_STEPS_PER_UNIT_TIME;
+  stepperCmdBuff_produceIdx = w;
 }
 
 #endif // FT_MOTION
@@ -37,6 +37,24 @@
   #endif
 #endif
 
+/**
+ * Stepper commands are packed into frames, one per trajectory data point:
+ *  - A word with the mask of axes that step during the frame.
+ *  - If any axes step, a word with their DIR bits, then the STEP bits of
+ *    only those axes for each of the FTM_STEPS_PER_UNIT_TIME ticks, packed
+ *    together and padded to a whole byte.
+ * Idle axes cost nothing and an idle frame is a single word.
+ */
+#define FTM_CMD_FRAME_MAX (2 * sizeof(ft_command_t) + ((FTM_STEPS_PER_UNIT_TIME) * (LOGICAL_AXES) + 7) / 8)
+
+/**
+ * Room for FTM_STEPPERCMD_BUFF_SIZE commands in frames where every axis steps,
+ * plus the partly read and the incoming frame, so the buffer always holds as
+ * many commands as the unpacked buffer did. (e.g., 2129 bytes instead of 6000
+ * for 3000 commands at 20 commands per frame on XYZE.)
+ */
+#define FTM_STEPPERCMD_BUFF_BYTES (((FTM_STEPPERCMD_BUFF_SIZE) / (FTM_STEPS_PER_UNIT_TIME) + 2) * FTM_CMD_FRAME_MAX + 1)
+
 typedef struct FTConfig {
   bool active = ENABLED(FTM_IS_DEFAULT_MOTION);           // Active (else standard motion)
 
@@ -109,9 +127,11 @@ class FTMotion {
       reset();
     }
 
-    static ft_command_t stepperCmdBuff[FTM_STEPPERCMD_BUFF_SIZE]; // Buffer of stepper commands.
-    static int32_t stepperCmdBuff_produceIdx,             // Index of next stepper command write to the buffer.
-                   stepperCmdBuff_consumeIdx;             // Index of next stepper command read from the buffer.
+    static uint8_t stepperCmdBuff[FTM_STEPPERCMD_BUFF_BYTES]; // Buffer of packed stepper command frames.
+    static int32_t stepperCmdBuff_produceIdx,             // Index of next byte write to the buffer.
+                   stepperCmdBuff_consumeIdx;             // Index of next byte read from the buffer.
+    static uint32_t stepperCmdBuff_produced,              // Count of stepper commands written to the buffer.
+                    stepperCmdBuff_consumed;              // Count of stepper commands read from the buffer.
 
     static bool sts_stepperBusy;                          // The stepper buffer has items and is in use.
 
@@ -129,6 +149,42 @@ class FTMotion {
 
     static void reset();                                  // Reset all states of the fixed time conversion to defaults.
 
+    /**
+     * Get the STEP and DIR bits for the next stepper command.
+     * Called from the Stepper ISR. Return false if the buffer is empty.
+     */
+    FORCE_INLINE static bool pop_stepper_command(ft_command_t &step_bits, ft_command_t &dir_bits) {
+      if (!cmdFrame.ticks) {
+        if (stepperCmdBuff_consumeIdx == stepperCmdBuff_produceIdx) return false;
+        cmdFrame.mask = read_cmd_word();
+        if (cmdFrame.mask) {
+          cmdFrame.dir = read_cmd_word();
+          cmdFrame.bits = __builtin_popcount(cmdFrame.mask);
+        }
+        cmdFrame.ticks = FTM_STEPS_PER_UNIT_TIME;
+        cmdFrame.acc = 0;
+        cmdFrame.acc_bits = 0;
+      }
+      cmdFrame.ticks--;
+      stepperCmdBuff_consumed++;
+
+      step_bits = 0;
+      if (cmdFrame.mask) {
+        while (cmdFrame.acc_bits < cmdFrame.bits) {
+          cmdFrame.acc |= uint32_t(read_cmd_byte()) << cmdFrame.acc_bits;
+          cmdFrame.acc_bits += 8;
+        }
+        // Spread the packed bits over the axes in the mask
+        uint32_t packed = cmdFrame.acc;
+        for (ft_command_t m = cmdFrame.mask; m; m &= m - 1, packed >>= 1)
+          if (packed & 1) step_bits |= m & -m;
+        cmdFrame.acc >>= cmdFrame.bits;
+        cmdFrame.acc_bits -= cmdFrame.bits;
+      }
+      dir_bits = cmdFrame.dir;
+      return true;
+    }
+
     FORCE_INLINE static bool axis_is_moving(const AxisEnum axis) {
       return cfg.active ? PENDING(millis(), axis_move_end_ti[axis]) : stepper.axis_is_moving(axis);
     }
@@ -148,6 +204,10 @@ class FTMotion {
     static xyze_pos_t   startPosn,          // (mm) Start position of block
                         endPosn_prevBlock;  // (mm) End position of previous block
     static xyze_float_t ratio;              // (ratio) Axis move ratio of block
+    #if ENABLED(FTM_ARC_BLOCKS)
+      static block_arc_t arc;               // Arc of the block, if any
+      static float arc_rad_per_mm;          // (rad/mm) Angular travel per mm along the block
+    #endif
     static float accel_P, decel_P,
                  F_P,
                  f_s,
@@ -169,12 +229,33 @@ class FTMotion {
 
     static xyze_long_t steps;
 
+    // Unpacking state of the stepper command frame being consumed
+    typedef struct {
+      uint8_t ticks;          // Commands left in the frame
+      ft_command_t mask, dir; // Axes stepping in the frame, and their directions
+      uint8_t bits;           // Packed bits per command
+      uint32_t acc;           // Bits read ahead from the buffer
+      uint8_t acc_bits;       // Count of bits in 'acc'
+    } cmd_frame_t;
+    static cmd_frame_t cmdFrame;
+
+    FORCE_INLINE static uint8_t read_cmd_byte() {
+      const uint8_t b = stepperCmdBuff[stepperCmdBuff_consumeIdx];
+      if (++stepperCmdBuff_consumeIdx == (FTM_STEPPERCMD_BUFF_BYTES)) stepperCmdBuff_consumeIdx = 0;
+      return b;
+    }
+    FORCE_INLINE static ft_command_t read_cmd_word() {
+      ft_command_t w = read_cmd_byte();
+      if (sizeof(ft_command_t) > 1) w |= ft_command_t(read_cmd_byte()) << 8;
+      return w;
+    }
+
     // Shaping variables.
     #if HAS_FTM_SHAPING
 
       typedef struct AxisShaping {
         bool ena = false;                 // Enabled indication.
-        float d_zi[FTM_ZMAX] = { 0.0f };  // Data point delay vector.
+        float d_zi[(FTM_ZMAX) + (FTM_WINDOW_SIZE)] = { 0.0f }; // Data point delay line. Room for a full window after FTM_ZMAX points of history.
         float Ai[5];                      // Shaping gain vector.
         uint32_t Ni[5];                   // Shaping time index vector.
         uint32_t max_i;                   // Vector length for the selected shaper.
@@ -182,10 +263,12 @@ class FTMotion {
         void set_axis_shaping_N(const ftMotionShaper_t shaper, const_float_t f, const_float_t zeta);    // Sets the gains used by shaping functions.
         void set_axis_shaping_A(const ftMotionShaper_t shaper, const_float_t zeta, const_float_t vtol); // Sets the indices used by shaping functions.
 
+        void shape(float * const __restrict pts, const uint32_t zi, const uint32_t n); // Shape consecutive data points in place.
+
       } axis_shaping_t;
 
       typedef struct Shaping {
-        uint32_t zi_idx;           // Index of storage in the data point delay vectors.
+        uint32_t zi_idx;           // Index of the next data point in the delay lines.
         #if HAS_X_AXIS
           axis_shaping_t x;
         #endif
@@ -207,8 +290,12 @@ class FTMotion {
     static void discard_planner_block_protected();
     static void runoutBlock();
     static int32_t stepperCmdBuffItems();
+    static int32_t stepperCmdBuffFree();
     static void loadBlockData(block_t *const current_block);
     static void makeVector();
+    #if HAS_FTM_SHAPING
+      static void shapeVector(const uint32_t start, const uint32_t n);
+    #endif
     static void convertToSteps(const uint32_t idx);
 
     FORCE_INLINE static int32_t num_samples_shaper_settle() { return ( shaping.x.ena || shaping.y.ena ) ? FTM_ZMAX : 0; }
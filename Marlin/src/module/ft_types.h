@@ -47,13 +47,10 @@ enum dynFreqMode_t : uint8_t {
 typedef struct XYZEarray<float, FTM_WINDOW_SIZE> xyze_trajectory_t;
 typedef struct XYZEarray<float, FTM_BATCH_SIZE> xyze_trajectoryMod_t;
 
-// TODO: Convert ft_command_t to a struct with bitfields instead of using a primitive type
+// Axis bits for stepper commands. Each command holds STEP or DIR bits for all axes.
 enum {
-  LIST_N(DOUBLE(LOGICAL_AXES),
-    FT_BIT_DIR_E, FT_BIT_STEP_E,
-    FT_BIT_DIR_X, FT_BIT_STEP_X, FT_BIT_DIR_Y, FT_BIT_STEP_Y, FT_BIT_DIR_Z, FT_BIT_STEP_Z,
-    FT_BIT_DIR_I, FT_BIT_STEP_I, FT_BIT_DIR_J, FT_BIT_STEP_J, FT_BIT_DIR_K, FT_BIT_STEP_K,
-    FT_BIT_DIR_U, FT_BIT_STEP_U, FT_BIT_DIR_V, FT_BIT_STEP_V, FT_BIT_DIR_W, FT_BIT_STEP_W
+  LIST_N(LOGICAL_AXES,
+    FT_BIT_E, FT_BIT_X, FT_BIT_Y, FT_BIT_Z, FT_BIT_I, FT_BIT_J, FT_BIT_K, FT_BIT_U, FT_BIT_V, FT_BIT_W
   ),
   FT_BIT_COUNT
 };
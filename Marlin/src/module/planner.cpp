@@ -128,10 +128,19 @@ Planner planner;
 block_t Planner::block_buffer[BLOCK_BUFFER_SIZE];
 volatile uint8_t Planner::block_buffer_head,    // Index of the next block to be pushed
                  Planner::block_buffer_nonbusy, // Index of the first non-busy block
+                 Planner::block_buffer_planned, // Index of the optimally planned block
                  Planner::block_buffer_tail;    // Index of the busy block, if any
 uint16_t Planner::cleaning_buffer_counter;      // A counter to disable queuing of blocks
 uint8_t Planner::delay_before_delivering;       // Delay block delivery so initial blocks in an empty queue may merge
 
+#if ENABLED(PLANNER_BENCHMARK)
+  uint32_t Planner::recalculate_count;          // Look-ahead passes since the benchmark started
+  uint64_t Planner::recalculate_time_ns;        // Total time spent in recalculate()
+  uint32_t Planner::recalculate_blocks;         // Blocks touched by all look-ahead passes
+  uint8_t Planner::recalculate_blocks_last,     // Blocks touched by the latest look-ahead pass
+          Planner::recalculate_blocks_max;      // Most blocks touched by a single look-ahead pass
+#endif
+
 #if ENABLED(EDITABLE_STEPS_PER_UNIT)
   float Planner::mm_per_step[DISTINCT_AXES];    // (mm) Millimeters per step
 #else
@@ -253,6 +262,11 @@ float Planner::previous_nominal_speed;
   volatile uint32_t Planner::block_buffer_runtime_us = 0;
 #endif
 
+#if ENABLED(AUTO_REPORT_PLANNER_STATS)
+  planner_stats_t Planner::stats = { 0, 0, 0, BLOCK_BUFFER_SIZE };
+  AutoReporter<Planner::AutoReportStats> Planner::stats_auto_reporter;
+#endif
+
 /**
  * Class and Instance Methods
  */
@@ -786,6 +800,69 @@ block_t* Planner::get_future_block(const uint8_t offset) {
   return block;
 }
 
+#if ENABLED(STEPPER_RAMP_TABLES)
+
+  // Fixed-point timer interval for a squared step rate, limited so any two intervals differ by less than INT32_MAX
+  static int32_t ramp_interval_fp(const float rate_sq) {
+    const float ticks_fp = float(STEPPER_TIMER_RATE) * (1UL << (RAMP_FRAC_BITS)),
+                    interval_max = float(0x7FFFFF00);
+    const float interval = ticks_fp * RSQRT(rate_sq);
+    return int32_t(interval < interval_max ? interval : interval_max);
+  }
+
+  /**
+   * Fill in a ramp table for a phase of 'steps' steps going from 'from_rate' to 'to_rate'.
+   *
+   * With constant acceleration the squared step rate is linear in the step count, so
+   * the exact interval is known at any step. The interval curve is steepest at low
+   * rates, so the runs end at geometrically spaced rates to give each run the same
+   * relative error. Each run is a chord of the convex interval curve, so the stepper
+   * is never faster than the ideal ramp.
+   */
+  void Planner::calculate_ramp_table(ramp_table_t &ramp, const uint32_t steps, const uint32_t from_rate, const uint32_t to_rate) {
+    if (!steps) return;
+
+    const float from_rate_sq = sq(float(from_rate)),
+                rate_sq_per_step = (sq(float(to_rate)) - from_rate_sq) / steps,
+                rate_ratio = POW(float(to_rate) / from_rate, 1.0f / (RAMP_TABLE_SEGMENTS));
+
+    // Exact intervals at the end of each run
+    int32_t node[RAMP_TABLE_SEGMENTS + 1];
+    node[0] = ramp_interval_fp(from_rate_sq);
+    float rate = from_rate, max_delta = 0;
+    uint32_t step = 0;
+    for (uint8_t i = 0; i < RAMP_TABLE_SEGMENTS; ++i) {
+      rate *= rate_ratio;
+      uint32_t end = steps;
+      if (i < (RAMP_TABLE_SEGMENTS) - 1 && rate_sq_per_step != 0)
+        end = _MIN(steps, uint32_t(_MAX(LROUND((sq(rate) - from_rate_sq) / rate_sq_per_step), 0L)));
+      NOLESS(end, step);
+      ramp.steps[i] = end - step;
+      step = end;
+      node[i + 1] = ramp_interval_fp(from_rate_sq + rate_sq_per_step * step);
+      if (ramp.steps[i]) NOLESS(max_delta, ABS(float(node[i + 1] - node[i])) / ramp.steps[i]);
+    }
+
+    // Use as many extra fraction bits as the steepest run allows
+    uint8_t shift = 16;
+    while (shift && max_delta * (1UL << shift) >= float(1UL << 30)) --shift;
+    ramp.shift = shift;
+
+    // Round each delta against the running total, as the ISR will add them up
+    int32_t interval = node[0];
+    ramp.start = interval;
+    for (uint8_t i = 0; i < RAMP_TABLE_SEGMENTS; ++i) {
+      int32_t delta = 0;
+      if (ramp.steps[i]) {
+        delta = LROUND(float(node[i + 1] - interval) * (1UL << shift) / ramp.steps[i]);
+        interval += int32_t((int64_t(delta) * ramp.steps[i]) >> shift);
+      }
+      ramp.delta[i] = delta;
+    }
+  }
+
+#endif // STEPPER_RAMP_TABLES
+
 /**
  * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
  * by the provided factors. If entry_factor is 0 don't change the initial_rate.
@@ -801,6 +878,8 @@ block_t* Planner::get_future_block(const uint8_t offset) {
  */
 void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t entry_speed, const_float_t exit_speed) {
 
+  TERN_(AUTO_REPORT_PLANNER_STATS, stats.trapezoids++);
+
   const float spmm = block->steps_per_mm;
   uint32_t initial_rate = entry_speed ? LROUND(entry_speed * spmm) : block->initial_rate,
            final_rate = LROUND(exit_speed * spmm);
@@ -809,7 +888,7 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
   NOLESS(final_rate,          stepper.minimal_step_rate);
   NOLESS(block->nominal_rate, stepper.minimal_step_rate);
 
-  #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
+  #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE, STEPPER_RAMP_TABLES)
     // If we have some plateau time, the cruise rate will be the nominal rate
     uint32_t cruise_rate = block->nominal_rate;
   #endif
@@ -844,7 +923,7 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
       LIMIT(accelerate_steps, 0, int32_t(block->step_event_count));
       decelerate_steps = block->step_event_count - accelerate_steps;
 
-      #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
+      #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE, STEPPER_RAMP_TABLES)
         // We won't reach the cruising rate. Let's calculate the speed we will reach
         NOMORE(cruise_rate, final_speed(initial_rate, accel, accelerate_steps));
       #endif
@@ -881,6 +960,10 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
   #if ENABLED(SMOOTH_LIN_ADVANCE)
     block->cruise_time = plateau_steps > 0 ? float(plateau_steps) * float(STEPPER_TIMER_RATE) / float(cruise_rate) : 0;
   #endif
+  #if ENABLED(STEPPER_RAMP_TABLES)
+    calculate_ramp_table(block->accel_ramp, accelerate_steps, initial_rate, cruise_rate);
+    calculate_ramp_table(block->decel_ramp, decelerate_steps, cruise_rate, final_rate);
+  #endif
 
   #if HAS_ROUGH_LIN_ADVANCE
     if (block->la_advance_rate) {
@@ -978,11 +1061,17 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
  *       so it's never updated again
  *    5. We use speed squared (ex: entry_speed_sqr in mm^2/s^2) in acceleration limit computations
  *    6. We don't recompute sqrt(entry_speed_sqr) if the block's entry speed didn't change
+ *    7. We keep a watermark (block_buffer_planned) at the last block whose entry speed can no longer
+ *       change, either because it's at max entry speed or it was limited by full acceleration on the
+ *       forward pass. Both passes stop at / start from the watermark so a new block only touches the
+ *       suffix of the plan that can still change.
  *
  *  Planner buffer index mapping:
  *  - block_buffer_tail: Points to the beginning of the planner buffer. First to be executed or being executed.
  *  - block_buffer_head: Points to the buffer block after the last block in the buffer. Used to indicate whether
  *      the buffer is full or empty. As described for standard ring buffers, this block is always empty.
+ *  - block_buffer_planned: Points to the optimally planned block. Only used while it's still ahead of
+ *      block_buffer_nonbusy. Otherwise the whole non-busy part of the buffer is planned.
  *
  *  NOTE: Since the planner only computes on what's in the planner buffer, some motions with many short
  *        segments (e.g., complex curves) may seem to move slowly. This is because there simply isn't
@@ -1039,6 +1128,17 @@ bool Planner::reverse_pass_kernel(block_t * const current, const block_t * const
   return false;
 }
 
+/**
+ * Is the optimally planned block still queued and ahead of the given
+ * first non-busy block? If not, the watermark is stale and the passes
+ * must fall back to the non-busy / tail block.
+ */
+bool Planner::planned_block_is_ahead(const uint8_t nonbusy_block_index) {
+  const uint8_t tail = block_buffer_tail,
+                planned = block_dec_mod(block_buffer_planned, tail);
+  return planned > block_dec_mod(nonbusy_block_index, tail) && planned < block_dec_mod(block_buffer_head, tail);
+}
+
 /**
  * recalculate() needs to go over the current plan twice.
  * Once in reverse and once forward. This implements the reverse pass that
@@ -1053,15 +1153,23 @@ void Planner::reverse_pass(const_float_t safe_exit_speed_sqr) {
   // The ISR may change block_buffer_nonbusy so get a stable local copy.
   uint8_t nonbusy_block_index = block_buffer_nonbusy;
 
+  // Don't try to change the entry speed of the optimally planned block
+  // or, if the ISR already passed it, of the first non-busy block.
+  uint8_t stop_block_index = planned_block_is_ahead(nonbusy_block_index) ? block_buffer_planned : nonbusy_block_index;
+
   const block_t *next = nullptr;
-  // Don't try to change the entry speed of the first non-busy block.
-  while (block_index != nonbusy_block_index) {
+  while (block_index != stop_block_index) {
     block_t *current = &block_buffer[block_index];
 
+    TERN_(PLANNER_BENCHMARK, recalculate_blocks_last++);
+
     // Only process movement blocks
     if (current->is_move()) {
-      // If no entry speed increase was possible we end the reverse pass.
-      if (!reverse_pass_kernel(current, next, safe_exit_speed_sqr)) return;
+      // If no entry speed increase was possible we end the reverse pass,
+      // unless it's one of a run of new blocks that were never planned.
+      if (!reverse_pass_kernel(current, next, safe_exit_speed_sqr)
+        && !TERN0(HAS_PLANNER_BATCH, next && current->flag.recalculate)
+      ) return;
       next = current;
     }
 
@@ -1075,6 +1183,9 @@ void Planner::reverse_pass(const_float_t safe_exit_speed_sqr) {
       // If we reached the busy block or an already processed block, break the loop now
       if (block_index == nonbusy_block_index) return;
 
+      // Once the ISR reaches the stop block, follow the busy block from there on
+      if (stop_block_index == nonbusy_block_index) stop_block_index = next_block_index(stop_block_index);
+
       // Advance the pointer, following the busy block
       nonbusy_block_index = next_block_index(nonbusy_block_index);
     }
@@ -1108,9 +1219,11 @@ void Planner::forward_pass_kernel(const block_t * const previous, block_t * cons
  * according to entry/exit speeds.
  */
 void Planner::recalculate_trapezoids(const_float_t safe_exit_speed_sqr) {
-  // Start with the block that's about to execute or is executing.
-  uint8_t block_index = block_buffer_tail,
-          head_block_index = block_buffer_head;
+  // Start with the optimally planned block, whose entry speed the reverse pass left alone.
+  // Failing that, the block that's about to execute or is executing.
+  uint8_t block_index = planned_block_is_ahead(block_buffer_nonbusy) ? block_buffer_planned : block_buffer_tail,
+          head_block_index = block_buffer_head,
+          planned_block_index = block_buffer_planned;
 
   block_t *block = nullptr, *next = nullptr;
   float next_entry_speed = 0.0f;
@@ -1118,6 +1231,8 @@ void Planner::recalculate_trapezoids(const_float_t safe_exit_speed_sqr) {
 
     next = &block_buffer[block_index];
 
+    TERN_(PLANNER_BENCHMARK, recalculate_blocks_last++);
+
     if (next->is_move()) {
       // Check if the next block's entry speed changed
       if (next->flag.recalculate) {
@@ -1150,6 +1265,11 @@ void Planner::recalculate_trapezoids(const_float_t safe_exit_speed_sqr) {
             if (next->entry_speed_sqr != next->min_entry_speed_sqr)
               forward_pass_kernel(block, next);
 
+            // A block at its max entry speed (including one limited by full acceleration
+            // above) can't be improved any more, and neither can anything before it.
+            if (next->entry_speed_sqr == next->max_entry_speed_sqr)
+              planned_block_index = block_index;
+
             const float current_entry_speed = next_entry_speed;
             next_entry_speed = SQRT(next->entry_speed_sqr);
 
@@ -1179,13 +1299,41 @@ void Planner::recalculate_trapezoids(const_float_t safe_exit_speed_sqr) {
     // the block from now on.
     block->flag.recalculate = false;
   }
+
+  // Move the watermark up, unless the ISR has already consumed the new planned block
+  if (planned_block_index != block_buffer_planned) {
+    const uint8_t tail = block_buffer_tail;
+    if (block_dec_mod(planned_block_index, tail) < block_dec_mod(head_block_index, tail))
+      block_buffer_planned = planned_block_index;
+  }
 }
 
 // Requires there's at least one block with flag.recalculate in the buffer
 void Planner::recalculate(const_float_t safe_exit_speed_sqr) {
+  #if ENABLED(PLANNER_BENCHMARK)
+    const uint64_t start_ns = Clock::nanos();
+    recalculate_blocks_last = 0;
+  #endif
+  #if ENABLED(AUTO_REPORT_PLANNER_STATS)
+    const uint32_t start_us = micros();
+  #endif
+
   reverse_pass(safe_exit_speed_sqr);
   // The forward pass is done as part of recalculate_trapezoids()
   recalculate_trapezoids(safe_exit_speed_sqr);
+
+  #if ENABLED(PLANNER_BENCHMARK)
+    recalculate_time_ns += Clock::nanos() - start_ns;
+    recalculate_count++;
+    recalculate_blocks += recalculate_blocks_last;
+    NOLESS(recalculate_blocks_max, recalculate_blocks_last);
+  #endif
+  #if ENABLED(AUTO_REPORT_PLANNER_STATS)
+    const uint32_t us = micros() - start_us;
+    stats.recalculations++;
+    stats.recalculate_us += us;
+    NOLESS(stats.recalculate_us_max, _MIN(us, uint32_t(UINT16_MAX)));
+  #endif
 }
 
 /**
@@ -1603,6 +1751,7 @@ void Planner::quick_stop() {
   const uint8_t tail_value = block_buffer_tail; // Read tail value once
   block_buffer_head = tail_value;
   block_buffer_nonbusy = tail_value;
+  block_buffer_planned = tail_value;
 
   // Restart the block delay for the first movement - As the queue was
   // forced to empty, there's no risk the ISR will touch this.
@@ -1780,6 +1929,15 @@ bool Planner::_buffer_steps(const xyze_long_t &target
     minimum_planner_speed_sqr
   );
 
+  #if HAS_PLANNER_BATCH
+    // buffer_lines() plans the whole run when it's done
+    if (batch_open) {
+      batch_exit_speed_sqr = safe_exit_speed_sqr;
+      batch_pending = true;
+      return true;
+    }
+  #endif
+
   // Recalculate and optimize trapezoidal speed profiles
   recalculate(safe_exit_speed_sqr);
 
@@ -2097,6 +2255,8 @@ bool Planner::_populate_block(
 
   TERN_(HAS_EXTRUDERS, block->steps.e = esteps);
 
+  TERN_(FTM_ARC_BLOCKS, block->arc = hints.arc);
+
   block->step_event_count = (
     #if NUM_AXES
       _MAX(LOGICAL_AXIS_LIST(esteps,
@@ -2295,6 +2455,15 @@ bool Planner::_populate_block(
     if (cs > max_fr) NOMORE(speed_factor, max_fr / cs);
   }
 
+  #if ENABLED(FTM_ARC_BLOCKS)
+    // Somewhere along an arc each plane axis may carry the whole speed in the plane
+    if (block->arc.angle) {
+      const feedRate_t cs = block->arc.radius * ABS(block->arc.angle) * inverse_secs;
+      const float max_fr = _MIN(settings.max_feedrate_mm_s[block->arc.axis_p], settings.max_feedrate_mm_s[block->arc.axis_q]);
+      if (cs > max_fr) NOMORE(speed_factor, max_fr / cs);
+    }
+  #endif
+
   // Limit speed on extruders, if any
   #if HAS_EXTRUDERS
   {
@@ -2457,6 +2626,21 @@ bool Planner::_populate_block(
       );
     }
   }
+
+  #if ENABLED(FTM_ARC_BLOCKS)
+    if (block->arc.angle) {
+      // Each plane axis of an arc may take all of the acceleration
+      NOMORE(accel, _MIN(settings.max_acceleration_mm_per_s2[block->arc.axis_p], settings.max_acceleration_mm_per_s2[block->arc.axis_q]) * steps_per_mm);
+
+      // Keep the centripetal acceleration within the same limit
+      const float max_speed = SQRT(accel / steps_per_mm * block->arc.radius);
+      if (block->nominal_speed > max_speed) {
+        block->nominal_rate = CEIL(block->nominal_rate * max_speed / block->nominal_speed);
+        block->nominal_speed = max_speed;
+      }
+    }
+  #endif
+
   block->acceleration_steps_per_s2 = accel;
   block->acceleration = accel / steps_per_mm;
   #if DISABLED(S_CURVE_ACCELERATION)
@@ -2555,10 +2739,28 @@ bool Planner::_populate_block(
      * => normalize the complete junction vector.
      * Elsewise, when needed JD will factor-in the E component
      */
-    if (ANY(IS_CORE, MARKFORGED_XY, MARKFORGED_YX) || esteps > 0)
+    #if ENABLED(FTM_ARC_BLOCKS)
+      // An arc block enters and leaves along its tangents, not along the chord
+      xyze_float_t exit_vec;
+      if (block->arc.angle) {
+        const block_arc_t &arc = block->arc;
+        const float cos_a = cos(arc.angle), sin_a = sin(arc.angle);
+        exit_vec = unit_vec;
+        unit_vec[arc.axis_p] = -arc.angle * arc.rvec.b;
+        unit_vec[arc.axis_q] =  arc.angle * arc.rvec.a;
+        exit_vec[arc.axis_p] = -arc.angle * (arc.rvec.a * sin_a + arc.rvec.b * cos_a);
+        exit_vec[arc.axis_q] =  arc.angle * (arc.rvec.a * cos_a - arc.rvec.b * sin_a);
+      }
+    #endif
+
+    if (ANY(IS_CORE, MARKFORGED_XY, MARKFORGED_YX) || esteps > 0) {
       normalize_junction_vector(unit_vec);  // Normalize with XYZE components
-    else
+      TERN_(FTM_ARC_BLOCKS, if (block->arc.angle) normalize_junction_vector(exit_vec));
+    }
+    else {
       unit_vec *= inverse_millimeters;      // Use pre-calculated (1 / SQRT(x^2 + y^2 + z^2))
+      TERN_(FTM_ARC_BLOCKS, if (block->arc.angle) exit_vec *= inverse_millimeters);
+    }
 
     // Skip first block or when previous_nominal_speed is used as a flag for homing and offset cycles.
     if (moves_queued && !UNEAR_ZERO(previous_nominal_speed)) {
@@ -2694,7 +2896,7 @@ bool Planner::_populate_block(
     }
     else vmax_junction_sqr = minimum_planner_speed_sqr;
 
-    prev_unit_vec = unit_vec;
+    prev_unit_vec = TERN_(FTM_ARC_BLOCKS, block->arc.angle ? exit_vec :) unit_vec;
 
   #else // CLASSIC_JERK
 
@@ -3089,6 +3291,51 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
 
 } // buffer_line()
 
+#if HAS_PLANNER_BATCH
+
+  bool Planner::batch_open, Planner::batch_pending; // = false
+  float Planner::batch_exit_speed_sqr; // = 0
+
+  void Planner::batch_recalculate() {
+    if (batch_pending) {
+      batch_pending = false;
+      recalculate(batch_exit_speed_sqr);
+    }
+  }
+
+  /**
+   * @brief Add a run of linear movements to the buffer.
+   * @details Each target is queued by buffer_line() with planning deferred,
+   *          then the look-ahead is recalculated once for all of them.
+   *
+   * @param carts     Target positions in mm or degrees
+   * @param count     Number of targets
+   * @param fr_mm_s   (Target) speed of the moves (mm/s)
+   * @param extruder  Target extruder
+   * @param hints     Parameters to aid planner calculations, shared by all moves
+   */
+  bool Planner::buffer_lines(const xyze_pos_t carts[], const uint8_t count, const_feedRate_t fr_mm_s
+    , const uint8_t extruder/*=active_extruder*/
+    , const PlannerHints &hints/*=PlannerHints()*/
+  ) {
+    // Wait for room to queue the run all at once
+    const uint8_t room = _MIN(count, uint8_t((BLOCK_BUFFER_SIZE) / 2));
+    while (moves_free() < room) idle();
+
+    bool queued = true;
+    batch_open = true;
+    for (uint8_t i = 0; queued && i < count; ++i) {
+      // Unplanned blocks can't be stepped, so plan before waiting for a free block
+      if (!moves_free()) batch_recalculate();
+      queued = buffer_line(carts[i], fr_mm_s, extruder, hints);
+    }
+    batch_open = false;
+    batch_recalculate();
+    return queued;
+  }
+
+#endif // HAS_PLANNER_BATCH
+
 #if ENABLED(DIRECT_STEPPING)
 
   void Planner::buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps) {
@@ -3339,6 +3586,70 @@ void Planner::set_max_feedrate(const AxisEnum axis, float inMaxFeedrateMMS) {
 
 #endif
 
+#if ENABLED(AUTO_REPORT_PLANNER_STATS)
+
+  /**
+   * Sample the queue depth and watch for the planner running dry
+   * while there are still commands waiting to be planned.
+   * Called from the Temperature ISR by Planner::isr().
+   */
+  void Planner::sample_stats() {
+    const uint8_t depth = movesplanned();
+    stats.samples++;
+    stats.depth_sum += depth;
+    NOMORE(stats.depth_min, depth);
+
+    if (!depth && queue.has_commands_queued()) {
+      if (!stats.starved) { stats.starved = true; stats.starvations++; }
+      stats.starved_samples++;
+    }
+    else
+      stats.starved = false;
+  }
+
+  /**
+   * Report planner statistics since the last report, then start over.
+   *
+   * "PS" followed by:
+   *  Q<avg>/<min>   Average and lowest queue depth (blocks)
+   *  S<n> (<ms>)    Times the planner ran dry with commands waiting, and for how long
+   *  R<n>/s         Look-ahead passes per second, roughly new blocks per second
+   *  L<avg>/<max>   Average and longest recalculate() time in µs
+   *  T<n>/s         Trapezoid recomputes per second
+   *  B<ms>          Buffered move time (with a wired LCD)
+   */
+  void Planner::report_stats() {
+    const bool was_on = hal.isr_state();
+    hal.isr_off();
+    const planner_stats_t s = stats;
+    stats.samples = stats.depth_sum = stats.starved_samples = 0;
+    stats.depth_min = BLOCK_BUFFER_SIZE;
+    stats.starvations = 0;
+    if (was_on) hal.isr_on();
+
+    const millis_t ms = millis(), elapsed_ms = _MAX(ms - s.start_ms, 1UL);
+    const float secs = elapsed_ms * 0.001f;
+
+    // Samples are taken by planner.isr(), so get the starved time from the measured sample rate
+    const uint32_t starved_ms = s.samples ? uint32_t(uint64_t(s.starved_samples) * elapsed_ms / s.samples) : 0UL;
+
+    SERIAL_ECHOPGM("PS"
+      " Q", p_float_t(s.samples ? float(s.depth_sum) / s.samples : 0.0f, 1), "/", s.samples ? s.depth_min : 0,
+      " S", s.starvations, " (", starved_ms, ")"
+      " R", p_float_t(s.recalculations / secs, 1), "/s"
+      " L", s.recalculations ? s.recalculate_us / s.recalculations : 0UL, "/", s.recalculate_us_max,
+      " T", p_float_t(s.trapezoids / secs, 1), "/s"
+    );
+    TERN_(HAS_WIRED_LCD, SERIAL_ECHOPGM(" B", block_buffer_runtime()));
+    SERIAL_EOL();
+
+    stats.start_ms = ms;
+    stats.recalculations = stats.trapezoids = stats.recalculate_us = 0;
+    stats.recalculate_us_max = 0;
+  }
+
+#endif // AUTO_REPORT_PLANNER_STATS
+
 #if HAS_WIRED_LCD
 
   uint16_t Planner::block_buffer_runtime() {
@@ -196,6 +196,40 @@ typedef struct {
 
 #endif
 
+#if ENABLED(STEPPER_RAMP_TABLES)
+
+  #define RAMP_FRAC_BITS 8
+
+  /**
+   * An acceleration or deceleration ramp as a table of timer intervals.
+   * The ramp is split into RAMP_TABLE_SEGMENTS runs. Within each run the interval
+   * changes linearly with the step count, so the Stepper ISR can follow the ramp
+   * without a divide. Intervals have RAMP_FRAC_BITS fraction bits.
+   */
+  typedef struct {
+    uint32_t start,                         // Interval of the first step, in fixed-point timer ticks
+             steps[RAMP_TABLE_SEGMENTS];    // Steps in each run
+    int32_t delta[RAMP_TABLE_SEGMENTS];     // Interval change per step in each run, with 'shift' extra fraction bits
+    uint8_t shift;
+  } ramp_table_t;
+
+#endif
+
+#if ENABLED(FTM_ARC_BLOCKS)
+
+  /**
+   * A circular arc in one plane, traced by FT Motion over the whole block.
+   * The other axes move linearly. An angle of zero means a straight block.
+   */
+  typedef struct {
+    float angle,                            // (rad) Angular travel, positive for counter-clockwise
+          radius;                           // (mm) Radius of the arc
+    xy_float_t rvec;                        // (mm) Start position relative to the center, in the arc plane
+    AxisEnum axis_p, axis_q;                // The axes of the arc plane
+  } block_arc_t;
+
+#endif
+
 /**
  * struct block_t
  *
@@ -263,6 +297,10 @@ typedef struct PlannerBlock {
   #else
     uint32_t acceleration_rate;             // Acceleration rate in (2^24 steps)/timer_ticks*s
   #endif
+  #if ENABLED(STEPPER_RAMP_TABLES)
+    ramp_table_t accel_ramp,                // Interval tables for the acceleration and deceleration phases
+                 decel_ramp;
+  #endif
 
   AxisBits direction_bits;                  // Direction bits set for this block, where 1 is negative motion
 
@@ -312,6 +350,10 @@ typedef struct PlannerBlock {
     block_laser_t laser;
   #endif
 
+  #if ENABLED(FTM_ARC_BLOCKS)
+    block_arc_t arc;
+  #endif
+
   void reset() { memset((char*)this, 0, sizeof(*this)); }
 
 } block_t;
@@ -320,6 +362,27 @@ typedef struct PlannerBlock {
   #define HAS_POSITION_FLOAT 1
 #endif
 
+#if ENABLED(AUTO_REPORT_PLANNER_STATS)
+  #include "../libs/autoreport.h"
+
+  /**
+   * Planner statistics gathered between reports
+   */
+  typedef struct {
+    millis_t start_ms;              // Start of the reporting interval
+    uint32_t samples,               // Queue depth samples taken by Planner::isr()
+             depth_sum;             // Sum of the sampled queue depths
+    uint8_t depth_min;              // Lowest sampled queue depth
+    bool starved;                   // The planner is dry while commands are waiting
+    uint16_t starvations;           // Times the planner ran dry while commands were waiting
+    uint32_t starved_samples,       // Samples taken while starved
+             recalculations,        // Look-ahead passes
+             trapezoids,            // Trapezoid recomputes
+             recalculate_us;        // Total time spent in recalculate()
+    uint16_t recalculate_us_max;    // Longest single recalculate()
+  } planner_stats_t;
+#endif
+
 constexpr uint8_t block_dec_mod(const uint8_t v1, const uint8_t v2) {
   return v1 >= v2 ? v1 - v2 : v1 - v2 + BLOCK_BUFFER_SIZE;
 }
@@ -431,6 +494,10 @@ struct PlannerHints {
                                       // would calculate if it knew the as-yet-unbuffered path
   #endif
 
+  #if ENABLED(FTM_ARC_BLOCKS)
+    block_arc_t arc = { 0 };          // Arc for FT Motion to trace, if the move is a whole arc and not a line
+  #endif
+
   #if HAS_ROTATIONAL_AXES
     bool cartesian_move = true;       // True if linear motion of the tool centerpoint relative to the workpiece occurs.
                                       // False if no movement of the tool center point relative to the work piece occurs
@@ -458,6 +525,7 @@ class Planner {
     static block_t block_buffer[BLOCK_BUFFER_SIZE];
     static volatile uint8_t block_buffer_head,      // Index of the next block to be pushed
                             block_buffer_nonbusy,   // Index of the first non busy block
+                            block_buffer_planned,   // Index of the optimally planned block
                             block_buffer_tail;      // Index of the busy block, if any
     static uint16_t cleaning_buffer_counter;        // A counter to disable queuing of blocks
     static uint8_t delay_before_delivering;         // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
@@ -466,6 +534,14 @@ class Planner {
       static uint8_t last_extruder;                 // Respond to extruder change
     #endif
 
+    #if ENABLED(PLANNER_BENCHMARK)
+      static uint32_t recalculate_count;            // Look-ahead passes since the benchmark started
+      static uint64_t recalculate_time_ns;          // Total time spent in recalculate()
+      static uint32_t recalculate_blocks;           // Blocks touched by all look-ahead passes
+      static uint8_t recalculate_blocks_last,       // Blocks touched by the latest look-ahead pass
+                     recalculate_blocks_max;        // Most blocks touched by a single look-ahead pass
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static uint32_t last_page_step_rate;          // Last page step rate given
       static AxisBits last_page_dir;                // Last page direction given, where 1 represents forward or positive motion
@@ -858,6 +934,7 @@ class Planner {
       block_buffer_tail = 0;
       block_buffer_head = 0;
       block_buffer_nonbusy = 0;
+      block_buffer_planned = 0;
     }
 
     // Check if movement queue is full
@@ -982,6 +1059,29 @@ class Planner {
       , const PlannerHints &hints=PlannerHints()
     );
 
+    #if HAS_PLANNER_BATCH
+      /**
+       * @fn Planner::buffer_lines
+       *
+       * @brief Add a run of linear movements to the buffer.
+       * @details Like buffer_line for each target in turn, but the look-ahead
+       *          is recalculated once for the run instead of once per block.
+       *          The stepper won't take the new blocks until they are planned.
+       *
+       * @param carts     Target positions in mm or degrees
+       * @param count     Number of targets
+       * @param fr_mm_s   (Target) speed of the moves (mm/s)
+       * @param extruder  Target extruder
+       * @param hints     Parameters to aid planner calculations, shared by all moves
+       *
+       * @return  false if a segment was not queued due to cleaning, cold extrusion, full queue, etc...
+       */
+      static bool buffer_lines(const xyze_pos_t carts[], const uint8_t count, const_feedRate_t fr_mm_s
+        , const uint8_t extruder=active_extruder
+        , const PlannerHints &hints=PlannerHints()
+      );
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
@@ -1062,7 +1162,10 @@ class Planner {
 
     // Periodic handler to manage the cleaning buffer counter
     // Called from the Temperature ISR at ~1kHz
-    static void isr() { if (cleaning_buffer_counter) --cleaning_buffer_counter; }
+    static void isr() {
+      if (cleaning_buffer_counter) --cleaning_buffer_counter;
+      TERN_(AUTO_REPORT_PLANNER_STATS, sample_stats());
+    }
 
     /**
      * Does the buffer have any blocks queued?
@@ -1092,8 +1195,12 @@ class Planner {
      * Called when the current block is no longer needed.
      */
     FORCE_INLINE static void release_current_block() {
-      if (has_blocks_queued())
-        block_buffer_tail = next_block_index(block_buffer_tail);
+      if (has_blocks_queued()) {
+        const uint8_t next_tail = next_block_index(block_buffer_tail);
+        // Drag the planned block along so it never falls behind the tail
+        if (block_buffer_planned == block_buffer_tail) block_buffer_planned = next_tail;
+        block_buffer_tail = next_tail;
+      }
     }
 
     #if HAS_WIRED_LCD
@@ -1101,6 +1208,14 @@ class Planner {
       static void clear_block_buffer_runtime();
     #endif
 
+    #if ENABLED(AUTO_REPORT_PLANNER_STATS)
+      static planner_stats_t stats;
+      static void sample_stats();
+      static void report_stats();
+      struct AutoReportStats { static void report() { report_stats(); } };
+      static AutoReporter<AutoReportStats> stats_auto_reporter;
+    #endif
+
     #if ENABLED(AUTOTEMP)
       static autotemp_t autotemp;
       static void autotemp_update();
@@ -1141,7 +1256,7 @@ class Planner {
       return target_velocity_sqr - 2 * accel * distance;
     }
 
-    #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
+    #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE, STEPPER_RAMP_TABLES)
       /**
        * Calculate the speed reached given initial speed, acceleration and distance
        */
@@ -1152,15 +1267,26 @@ class Planner {
 
     static void calculate_trapezoid_for_block(block_t * const block, const_float_t entry_speed, const_float_t exit_speed);
 
+    #if ENABLED(STEPPER_RAMP_TABLES)
+      static void calculate_ramp_table(ramp_table_t &ramp, const uint32_t steps, const uint32_t from_rate, const uint32_t to_rate);
+    #endif
+
     static bool reverse_pass_kernel(block_t * const current, const block_t * const next, const_float_t safe_exit_speed_sqr);
     static void forward_pass_kernel(const block_t * const previous, block_t * const current);
 
+    static bool planned_block_is_ahead(const uint8_t nonbusy_block_index);
     static void reverse_pass(const_float_t safe_exit_speed_sqr);
 
     static void recalculate_trapezoids(const_float_t safe_exit_speed_sqr);
 
     static void recalculate(const_float_t safe_exit_speed_sqr);
 
+    #if HAS_PLANNER_BATCH
+      static bool batch_open, batch_pending;  // Defer recalculate() while buffer_lines() queues a run
+      static float batch_exit_speed_sqr;      // Safe exit speed of the last block in the run
+      static void batch_recalculate();
+    #endif
+
     #if IS_KINEMATIC
       // Allow do_homing_move to access internal functions, such as buffer_segment.
       friend void do_homing_move(const AxisEnum, const float, const feedRate_t, const bool);
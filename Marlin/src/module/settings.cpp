@@ -732,6 +732,7 @@ void MarlinSettings::postprocess() {
   TERN_(DELTA, recalc_delta_settings());
 
   TERN_(PIDTEMP, thermalManager.updatePID());
+  TERN_(MPCTEMP, thermalManager.updateMPC());
 
   #if DISABLED(NO_VOLUMETRICS)
     planner.calculate_volumetric_multipliers();
@@ -2361,7 +2362,12 @@ void MarlinSettings::postprocess() {
         user_thermistor_t user_thermistor[USER_THERMISTORS];
         _FIELD_TEST(user_thermistor);
         EEPROM_READ(user_thermistor);
-        if (!validating) COPY(thermalManager.user_thermistor, user_thermistor);
+        if (!validating) {
+          COPY(thermalManager.user_thermistor, user_thermistor);
+          #if ENABLED(USER_THERMISTOR_LUT)
+            for (auto &t : thermalManager.user_thermistor) t.pre_calc = true; // Rebuild the tables
+          #endif
+        }
       }
       #endif
 
@@ -0,0 +1,77 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Soft PWM schedule
+ *
+ * Each soft PWM output turns on at the start of the PWM period and off on the
+ * first Temperature ISR tick that reaches its count. Instead of testing every
+ * output on every tick, the schedule sorts the outputs by count when a period
+ * starts, so a tick only has to check the next output due to turn off.
+ *
+ * The order is kept from one period to the next and insertion sorted, which is
+ * a single pass while the duty cycles stay the same.
+ */
+
+#include <stdint.h>
+
+template<uint8_t CHANNELS>
+class SoftPWMSchedule {
+  uint8_t count[CHANNELS];  // Count of each output for this period, including the dither carry
+  uint8_t order[CHANNELS];  // Outputs in the order they turn off
+  uint8_t next;             // Index in 'order' of the next output to turn off
+
+public:
+  SoftPWMSchedule() {
+    for (uint8_t ch = 0; ch < CHANNELS; ++ch) count[ch] = 0, order[ch] = ch;
+    next = CHANNELS;
+  }
+
+  /**
+   * Start a PWM period, calling write(ch, on) for every output.
+   * With dithering, 'mask' selects the low bits of the count carried over from the last period.
+   */
+  template<typename F>
+  void start(const uint8_t mask, const uint8_t amount[CHANNELS], F write) {
+    for (uint8_t ch = 0; ch < CHANNELS; ++ch) {
+      count[ch] = (count[ch] & mask) + amount[ch];
+      write(ch, count[ch] > mask);
+    }
+
+    for (uint8_t i = 1; i < CHANNELS; ++i) {
+      const uint8_t ch = order[i], c = count[ch];
+      uint8_t j = i;
+      for (; j && count[order[j - 1]] > c; --j) order[j] = order[j - 1];
+      order[j] = ch;
+    }
+
+    // Skip the outputs that stay off for this period
+    for (next = 0; next < CHANNELS && count[order[next]] <= mask; ++next) { /* nada */ }
+  }
+
+  // Turn off the outputs whose count has been reached by 'tick'
+  template<typename F>
+  void run(const uint8_t tick, F write) {
+    for (; next < CHANNELS && count[order[next]] <= tick; ++next) write(order[next], false);
+  }
+};
@@ -241,6 +241,12 @@ uint32_t Stepper::advance_divisor = 0,
   bool Stepper::bezier_2nd_half;    // =false If Bézier curve has been initialized or not
 #endif
 
+#if ENABLED(STEPPER_RAMP_TABLES)
+  uint32_t Stepper::ramp_base, Stepper::ramp_start;
+  uint8_t Stepper::ramp_index;
+  bool Stepper::ramp_2nd_half;      // =false If the deceleration ramp has been started
+#endif
+
 #if ENABLED(LIN_ADVANCE)
   hal_timer_t Stepper::nextAdvanceISR = LA_ADV_NEVER,
               Stepper::la_interval = LA_ADV_NEVER;
@@ -2309,6 +2315,43 @@ hal_timer_t Stepper::calc_multistep_timer_interval(uint32_t step_rate) {
   return calc_timer_interval(step_rate);
 }
 
+#if ENABLED(STEPPER_RAMP_TABLES)
+
+  // Start following a ramp table at the given step index
+  void Stepper::_init_ramp(const ramp_table_t &ramp, const uint32_t start) {
+    ramp_base = ramp.start;
+    ramp_start = start;
+    ramp_index = 0;
+  }
+
+  /**
+   * Get the timer interval for the current step from a ramp table.
+   * A multiply-add replaces the step rate calculation and the divide.
+   */
+  hal_timer_t Stepper::_eval_ramp(const ramp_table_t &ramp) {
+    const uint32_t step = step_events_completed >> oversampling_factor;
+
+    // Move on to the run holding the current step
+    while (ramp_index < (RAMP_TABLE_SEGMENTS) - 1 && step - ramp_start >= ramp.steps[ramp_index]) {
+      ramp_base += int32_t((int64_t(ramp.delta[ramp_index]) * ramp.steps[ramp_index]) >> ramp.shift);
+      ramp_start += ramp.steps[ramp_index];
+      ++ramp_index;
+    }
+
+    // Interpolate within the run
+    uint32_t ticks = (ramp_base + int32_t((int64_t(ramp.delta[ramp_index]) * (step - ramp_start)) >> ramp.shift)) >> (RAMP_FRAC_BITS);
+
+    // Multi-stepping waits longer, oversampling shorter
+    #if MULTISTEPPING_LIMIT > 1
+      ticks *= steps_per_isr;
+    #endif
+    ticks >>= oversampling_factor;
+
+    return ticks < HAL_TIMER_TYPE_MAX ? hal_timer_t(ticks) : HAL_TIMER_TYPE_MAX;
+  }
+
+#endif // STEPPER_RAMP_TABLES
+
 // Method to get all moving axes (for proper endstop handling)
 void Stepper::set_axis_moved_for_current_block() {
 
@@ -2446,20 +2489,29 @@ hal_timer_t Stepper::block_phase_isr() {
       // Are we in acceleration phase ?
       if (step_events_completed < accelerate_before) { // Calculate new timer value
 
-        #if ENABLED(S_CURVE_ACCELERATION)
-          // Get the next speed to use (Jerk limited!)
-          uint32_t acc_step_rate = acceleration_time < current_block->acceleration_time
-                                   ? _eval_bezier_curve(acceleration_time)
-                                   : current_block->cruise_rate;
+        #if ENABLED(STEPPER_RAMP_TABLES)
+
+          // Timer interval and steps per stepper isr from the planner's table
+          interval = _eval_ramp(current_block->accel_ramp);
+
         #else
-          acc_step_rate = STEP_MULTIPLY(acceleration_time, current_block->acceleration_rate) + current_block->initial_rate;
-          NOMORE(acc_step_rate, current_block->nominal_rate);
-        #endif
 
-        // acc_step_rate is in steps/second
+          #if ENABLED(S_CURVE_ACCELERATION)
+            // Get the next speed to use (Jerk limited!)
+            uint32_t acc_step_rate = acceleration_time < current_block->acceleration_time
+                                     ? _eval_bezier_curve(acceleration_time)
+                                     : current_block->cruise_rate;
+          #else
+            acc_step_rate = STEP_MULTIPLY(acceleration_time, current_block->acceleration_rate) + current_block->initial_rate;
+            NOMORE(acc_step_rate, current_block->nominal_rate);
+          #endif
+
+          // acc_step_rate is in steps/second
+
+          // step_rate to timer interval and steps per stepper isr
+          interval = calc_multistep_timer_interval(acc_step_rate << oversampling_factor);
 
-        // step_rate to timer interval and steps per stepper isr
-        interval = calc_multistep_timer_interval(acc_step_rate << oversampling_factor);
+        #endif
         acceleration_time += interval;
         deceleration_time = 0; // Reset since we're doing acceleration first.
 
@@ -2500,33 +2552,50 @@ hal_timer_t Stepper::block_phase_isr() {
       }
       // Are we in Deceleration phase ?
       else if (step_events_completed >= decelerate_start) {
-        uint32_t step_rate;
 
-        #if ENABLED(S_CURVE_ACCELERATION)
+        #if ENABLED(STEPPER_RAMP_TABLES)
+
           // If this is the 1st time we process the 2nd half of the trapezoid...
-          if (!bezier_2nd_half) {
-            // Initialize the Bézier speed curve
-            _calc_bezier_curve_coeffs(current_block->cruise_rate, current_block->final_rate, current_block->deceleration_time_inverse);
-            bezier_2nd_half = true;
+          if (!ramp_2nd_half) {
+            // Follow the deceleration table from the first decelerating step
+            _init_ramp(current_block->decel_ramp, current_block->decelerate_start);
+            ramp_2nd_half = true;
           }
-          // Calculate the next speed to use
-          step_rate = deceleration_time < current_block->deceleration_time
-            ? _eval_bezier_curve(deceleration_time)
-            : current_block->final_rate;
+
+          // Timer interval and steps per stepper isr from the planner's table
+          interval = _eval_ramp(current_block->decel_ramp);
+
         #else
-          // Using the old trapezoidal control
-          step_rate = STEP_MULTIPLY(deceleration_time, current_block->acceleration_rate);
-          if (step_rate < acc_step_rate) {
-            step_rate = acc_step_rate - step_rate;
-            NOLESS(step_rate, current_block->final_rate);
-          }
-          else
-            step_rate = current_block->final_rate;
 
-        #endif
+          uint32_t step_rate;
 
-        // step_rate to timer interval and steps per stepper isr
-        interval = calc_multistep_timer_interval(step_rate << oversampling_factor);
+          #if ENABLED(S_CURVE_ACCELERATION)
+            // If this is the 1st time we process the 2nd half of the trapezoid...
+            if (!bezier_2nd_half) {
+              // Initialize the Bézier speed curve
+              _calc_bezier_curve_coeffs(current_block->cruise_rate, current_block->final_rate, current_block->deceleration_time_inverse);
+              bezier_2nd_half = true;
+            }
+            // Calculate the next speed to use
+            step_rate = deceleration_time < current_block->deceleration_time
+              ? _eval_bezier_curve(deceleration_time)
+              : current_block->final_rate;
+          #else
+            // Using the old trapezoidal control
+            step_rate = STEP_MULTIPLY(deceleration_time, current_block->acceleration_rate);
+            if (step_rate < acc_step_rate) {
+              step_rate = acc_step_rate - step_rate;
+              NOLESS(step_rate, current_block->final_rate);
+            }
+            else
+              step_rate = current_block->final_rate;
+
+          #endif
+
+          // step_rate to timer interval and steps per stepper isr
+          interval = calc_multistep_timer_interval(step_rate << oversampling_factor);
+
+        #endif
         deceleration_time += interval;
 
         #if ENABLED(NONLINEAR_EXTRUSION)
@@ -2836,6 +2905,12 @@ hal_timer_t Stepper::block_phase_isr() {
         acc_step_rate = current_block->initial_rate;
       #endif
 
+      #if ENABLED(STEPPER_RAMP_TABLES)
+        // Follow the acceleration table from the first step
+        _init_ramp(current_block->accel_ramp, 0);
+        ramp_2nd_half = false;
+      #endif
+
       #if ENABLED(NONLINEAR_EXTRUSION)
         ne_edividend = advance_dividend.e;
         const float scale = (float(ne_edividend) / advance_divisor) * planner.mm_per_step[E_AXIS_N(current_block->extruder)];
@@ -3539,28 +3614,24 @@ void Stepper::report_positions() {
    *
    * - Set ftMotion.sts_stepperBusy state to reflect whether there are any commands in the circular buffer.
    * - If there are no commands in the buffer, return.
-   * - Get the next command from the circular buffer ftMotion.stepperCmdBuff[].
+   * - Get the next command from the packed circular buffer ftMotion.stepperCmdBuff[].
    * - If the block is being aborted, return without processing the command.
    * - Apply STEP/DIR along with any delays required. A command may be empty, with no STEP/DIR.
    */
   void Stepper::ftMotion_stepper() {
 
-    // Check if the buffer is empty.
-    ftMotion.sts_stepperBusy = (ftMotion.stepperCmdBuff_produceIdx != ftMotion.stepperCmdBuff_consumeIdx);
+    // "Pop" one command from current motion buffer, if not empty
+    ft_command_t step_bits, dir_bits;
+    ftMotion.sts_stepperBusy = ftMotion.pop_stepper_command(step_bits, dir_bits);
     if (!ftMotion.sts_stepperBusy) return;
 
-    // "Pop" one command from current motion buffer
-    const ft_command_t command = ftMotion.stepperCmdBuff[ftMotion.stepperCmdBuff_consumeIdx];
-    if (++ftMotion.stepperCmdBuff_consumeIdx == (FTM_STEPPERCMD_BUFF_SIZE))
-      ftMotion.stepperCmdBuff_consumeIdx = 0;
-
     if (abort_current_block) return;
 
     USING_TIMED_PULSE();
 
     // Get FT Motion command flags for axis STEP / DIR
-    #define _FTM_STEP(AXIS) TEST(command, FT_BIT_STEP_##AXIS)
-    #define _FTM_DIR(AXIS) TEST(command, FT_BIT_DIR_##AXIS)
+    #define _FTM_STEP(AXIS) TEST(step_bits, FT_BIT_##AXIS)
+    #define _FTM_DIR(AXIS) TEST(dir_bits, FT_BIT_##AXIS)
 
     /**
      * Update direction bits for steppers that were stepped by this command.
@@ -437,6 +437,13 @@ class Stepper {
       static bool bezier_2nd_half; // If Bézier curve has been initialized or not
     #endif
 
+    #if ENABLED(STEPPER_RAMP_TABLES)
+      static uint32_t ramp_base,   // Interval at the start of the current ramp run, in fixed-point timer ticks
+                      ramp_start;  // Step index where the current ramp run starts
+      static uint8_t ramp_index;   // Current run in the ramp table
+      static bool ramp_2nd_half;   // If the deceleration ramp has been started
+    #endif
+
     #if HAS_ZV_SHAPING
       #if ENABLED(INPUT_SHAPING_X)
         static ShapeParams shaping_x;
@@ -747,6 +754,12 @@ class Stepper {
       static int32_t _eval_bezier_curve(const uint32_t curr_step);
     #endif
 
+    #if ENABLED(STEPPER_RAMP_TABLES)
+      // Get the timer interval for the current step from a ramp table
+      static void _init_ramp(const ramp_table_t &ramp, const uint32_t start);
+      static hal_timer_t _eval_ramp(const ramp_table_t &ramp);
+    #endif
+
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
       static void digipot_init();
     #endif
@@ -236,16 +236,69 @@
   #include "servo.h"
 #endif
 
+#if ENABLED(SOFT_PWM_SCHEDULE)
+  #include "soft_pwm.h"
+#endif
+
 #if ANY(TEMP_SENSOR_0_IS_THERMISTOR, TEMP_SENSOR_1_IS_THERMISTOR, TEMP_SENSOR_2_IS_THERMISTOR, TEMP_SENSOR_3_IS_THERMISTOR, \
         TEMP_SENSOR_4_IS_THERMISTOR, TEMP_SENSOR_5_IS_THERMISTOR, TEMP_SENSOR_6_IS_THERMISTOR, TEMP_SENSOR_7_IS_THERMISTOR )
   #define HAS_HOTEND_THERMISTOR 1
 #endif
 
+// Grid indexes for the conversion tables in use
+#define DEFINE_TEMPGRID(N, T) constexpr thermistor_grid_t tempgrid_##N PROGMEM = make_thermistor_grid(T);
+#if TEMP_SENSOR_0_IS_THERMISTOR
+  DEFINE_TEMPGRID(0, TEMPTABLE_0)
+#endif
+#if TEMP_SENSOR_1_IS_THERMISTOR
+  DEFINE_TEMPGRID(1, TEMPTABLE_1)
+#endif
+#if TEMP_SENSOR_2_IS_THERMISTOR
+  DEFINE_TEMPGRID(2, TEMPTABLE_2)
+#endif
+#if TEMP_SENSOR_3_IS_THERMISTOR
+  DEFINE_TEMPGRID(3, TEMPTABLE_3)
+#endif
+#if TEMP_SENSOR_4_IS_THERMISTOR
+  DEFINE_TEMPGRID(4, TEMPTABLE_4)
+#endif
+#if TEMP_SENSOR_5_IS_THERMISTOR
+  DEFINE_TEMPGRID(5, TEMPTABLE_5)
+#endif
+#if TEMP_SENSOR_6_IS_THERMISTOR
+  DEFINE_TEMPGRID(6, TEMPTABLE_6)
+#endif
+#if TEMP_SENSOR_7_IS_THERMISTOR
+  DEFINE_TEMPGRID(7, TEMPTABLE_7)
+#endif
+#if TEMP_SENSOR_BED_IS_THERMISTOR
+  DEFINE_TEMPGRID(bed, TEMPTABLE_BED)
+#endif
+#if TEMP_SENSOR_CHAMBER_IS_THERMISTOR
+  DEFINE_TEMPGRID(chamber, TEMPTABLE_CHAMBER)
+#endif
+#if TEMP_SENSOR_COOLER_IS_THERMISTOR
+  DEFINE_TEMPGRID(cooler, TEMPTABLE_COOLER)
+#endif
+#if TEMP_SENSOR_PROBE_IS_THERMISTOR
+  DEFINE_TEMPGRID(probe, TEMPTABLE_PROBE)
+#endif
+#if TEMP_SENSOR_BOARD_IS_THERMISTOR
+  DEFINE_TEMPGRID(board, TEMPTABLE_BOARD)
+#endif
+#if TEMP_SENSOR_REDUNDANT_IS_THERMISTOR
+  DEFINE_TEMPGRID(redundant, TEMPTABLE_REDUNDANT)
+#endif
+#undef DEFINE_TEMPGRID
+
 #if HAS_HOTEND_THERMISTOR
   #define NEXT_TEMPTABLE(N) ,TEMPTABLE_##N
   #define NEXT_TEMPTABLE_LEN(N) ,TEMPTABLE_##N##_LEN
+  #define _TEMPGRID(N) TERN(TEMP_SENSOR_##N##_IS_THERMISTOR, &tempgrid_##N, nullptr)
+  #define NEXT_TEMPGRID(N) ,_TEMPGRID(N)
   static const temp_entry_t* heater_ttbl_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0 REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE));
   static constexpr uint8_t heater_ttbllen_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0_LEN REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE_LEN));
+  static const thermistor_grid_t* heater_tgrid_map[HOTENDS] = ARRAY_BY_HOTENDS(_TEMPGRID(0) REPEAT_S(1, HOTENDS, NEXT_TEMPGRID));
 #endif
 
 Temperature thermalManager;
@@ -618,6 +671,9 @@ PGMSTR(str_t_heating_failed, STR_T_HEATING_FAILED);
  */
 
 volatile bool Temperature::raw_temps_ready = false;
+#if ENABLED(ADC_SCAN_MODE)
+  ADCScanHandoff<ADC_SCAN_CHANNELS, OVERSAMPLENR> Temperature::adc_scan;
+#endif
 
 #define TEMPDIR(N) ((TEMP_SENSOR_##N##_RAW_LO_TEMP) < (TEMP_SENSOR_##N##_RAW_HI_TEMP) ? 1 : -1)
 #define TP_CMP(S,A,B) (TEMPDIR(S) < 0 ? ((A)<(B)) : ((A)>(B)))
@@ -1097,6 +1153,7 @@ void Temperature::factory_reset() {
 
     temp_hotend[e].target = 0.0f;
     temp_hotend[e].soft_pwm_amount = 0;
+    updateMPC(); // Stopping early may leave partly tuned values
     #if HAS_FAN
       set_fan_speed(TERN(SINGLEFAN, 0, e), 0);
       planner.sync_fan_speeds(fan_speed);
@@ -1392,6 +1449,8 @@ void Temperature::factory_reset() {
       mpc.sensor_responsiveness = tuner.get_rate_fastest() / (tuner.get_rate_fastest() * tuner.get_time_fastest() + tuner.get_ambient_temp() - tuner.get_temp_fastest());
     }
 
+    updateMPC(); // The model controls the heater with these values next
+
     hotend.modeled_block_temp = asymp_temp + (tuner.get_ambient_temp() - asymp_temp) * exp(-block_responsiveness * tuner.get_elapsed_heating_time());
     hotend.modeled_sensor_temp = tuner.get_last_measured_temp();
 
@@ -1438,6 +1497,8 @@ void Temperature::factory_reset() {
       }
     }
 
+    updateMPC();
+
     SERIAL_ECHOLNPGM(STR_MPC_AUTOTUNE_FINISHED);
     TERN_(EXTENSIBLE_UI, ExtUI::onMPCTuning(ExtUI::mpcresult_t::MPC_DONE));
 
@@ -1839,16 +1900,18 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
         const bool this_hotend = (ee == active_extruder);
       #endif
 
-      float ambient_xfer_coeff = mpc.ambient_xfer_coeff_fan0;
+      // Coefficients are only recomputed after M306 or a fan speed change
       #if ENABLED(MPC_INCLUDE_FAN)
         const uint8_t fan_index = TERN(SINGLEFAN, 0, ee);
-        const float fan_fraction = TERN_(MPC_FAN_0_ACTIVE_HOTEND, !this_hotend ? 0.0f :) fan_speed[fan_index] * RECIPROCAL(255);
-        ambient_xfer_coeff += fan_fraction * mpc.fan255_adjustment;
+        hotend.refresh_model(TERN_(MPC_FAN_0_ACTIVE_HOTEND, !this_hotend ? 0 :) fan_speed[fan_index]);
+      #else
+        hotend.refresh_model();
       #endif
+      float ambient_xfer_coeff = hotend.model.ambient_xfer_coeff;
 
       if (this_hotend) {
         const int32_t e_position = stepper.position(E_AXIS);
-        const float e_speed = (e_position - MPC::e_position) * planner.mm_per_step[E_AXIS] / MPC_dT;
+        const float e_speed = (e_position - MPC::e_position) * planner.mm_per_step[E_AXIS] * RECIPROCAL(MPC_dT);
 
         // The position can appear to make big jumps when, e.g., homing
         if (fabs(e_speed) > planner.settings.max_feedrate_mm_s[E_AXIS])
@@ -1860,11 +1923,11 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
       }
 
       // Update the modeled temperatures
-      float blocktempdelta = hotend.soft_pwm_amount * mpc.heater_power * (MPC_dT / 127) / mpc.block_heat_capacity;
-      blocktempdelta += (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * ambient_xfer_coeff * MPC_dT / mpc.block_heat_capacity;
+      float blocktempdelta = hotend.soft_pwm_amount * hotend.model.heater_gain;
+      blocktempdelta += (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * ambient_xfer_coeff * hotend.model.heat_gain;
       hotend.modeled_block_temp += blocktempdelta;
 
-      const float sensortempdelta = (hotend.modeled_block_temp - hotend.modeled_sensor_temp) * (mpc.sensor_responsiveness * MPC_dT);
+      const float sensortempdelta = (hotend.modeled_block_temp - hotend.modeled_sensor_temp) * hotend.model.sensor_gain;
       hotend.modeled_sensor_temp += sensortempdelta;
 
       // Any delta between hotend.modeled_sensor_temp and hotend.celsius is either model
@@ -1880,11 +1943,11 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
       float power = 0.0;
       if (hotend.target != 0 && !is_idling) {
         // Plan power level to get to target temperature in 2 seconds
-        power = (hotend.target - hotend.modeled_block_temp) * mpc.block_heat_capacity / 2.0f;
+        power = (hotend.target - hotend.modeled_block_temp) * mpc.block_heat_capacity * 0.5f;
         power -= (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * ambient_xfer_coeff;
       }
 
-      float pid_output = power * 254.0f / mpc.heater_power + 1.0f;        // Ensure correct quantization into a range of 0 to 127
+      float pid_output = power * hotend.model.power_gain + 1.0f;          // Ensure correct quantization into a range of 0 to 127
       LIMIT(pid_output, 0, MPC_MAX);
 
       /* <-- add a slash to enable
@@ -2461,28 +2524,6 @@ void Temperature::task() {
 // For a 5V input the AD8495 returns a value scaled with 5mV per °C. (Minimum input voltage is 2.7V.)
 #define TEMP_AD8495(RAW) ((RAW) * (ADC_VREF_MV /  5) / float(HAL_ADC_RANGE) / (OVERSAMPLENR) * (TEMP_SENSOR_AD8495_GAIN) + TEMP_SENSOR_AD8495_OFFSET)
 
-/**
- * Bisect search for the range of the 'raw' value, then interpolate
- * proportionally between the under and over values.
- */
-#define SCAN_THERMISTOR_TABLE(TBL,LEN) do{                                \
-  uint8_t l = 0, r = LEN, m;                                              \
-  for (;;) {                                                              \
-    m = (l + r) >> 1;                                                     \
-    if (!m) return celsius_t(pgm_read_word(&TBL[0].celsius));             \
-    if (m == l || m == r) return celsius_t(pgm_read_word(&TBL[LEN-1].celsius)); \
-    raw_adc_t v00 = pgm_read_word(&TBL[m-1].value),                       \
-              v10 = pgm_read_word(&TBL[m-0].value);                       \
-         if (raw < v00) r = m;                                            \
-    else if (raw > v10) l = m;                                            \
-    else {                                                                \
-      const celsius_t v01 = celsius_t(pgm_read_word(&TBL[m-1].celsius)),  \
-                      v11 = celsius_t(pgm_read_word(&TBL[m-0].celsius));  \
-      return v01 + (raw - v00) * float(v11 - v01) / float(v10 - v00);     \
-    }                                                                     \
-  }                                                                       \
-}while(0)
-
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load
@@ -2548,7 +2589,7 @@ void Temperature::task() {
       FPSTR(SP_B_STR), p_float_t(t.beta, 1), FPSTR(SP_C_STR), p_float_t(t.sh_c_coeff, 9),
       F(" ; ")
     );
-    SERIAL_ECHOLN(
+    SERIAL_ECHO(
       TERN_(TEMP_SENSOR_0_IS_CUSTOM, t_index == CTI_HOTEND_0 ? F("HOTEND 0") :)
       TERN_(TEMP_SENSOR_1_IS_CUSTOM, t_index == CTI_HOTEND_1 ? F("HOTEND 1") :)
       TERN_(TEMP_SENSOR_2_IS_CUSTOM, t_index == CTI_HOTEND_2 ? F("HOTEND 2") :)
@@ -2565,22 +2606,14 @@ void Temperature::task() {
       TERN_(TEMP_SENSOR_REDUNDANT_IS_CUSTOM, t_index == CTI_REDUNDANT ? F("REDUNDANT") :)
       FSTR_P(nullptr)
     );
+    #if ENABLED(USER_THERMISTOR_LUT)
+      SERIAL_ECHOPGM(" (LUT +/-", p_float_t(user_thermistor_lut_error(t_index), 2), "C)");
+    #endif
+    SERIAL_EOL();
   }
 
-  celsius_float_t Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const raw_adc_t raw) {
-
-    if (!WITHIN(t_index, 0, COUNT(user_thermistor) - 1)) return 25;
-
-    user_thermistor_t &t = user_thermistor[t_index];
-    if (t.pre_calc) { // pre-calculate some variables
-      t.pre_calc     = false;
-      t.res_25_recip = 1.0f / t.res_25;
-      t.res_25_log   = logf(t.res_25);
-      t.beta_recip   = 1.0f / t.beta;
-      t.sh_alpha     = RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
-                        - (t.beta_recip * t.res_25_log) - (t.sh_c_coeff * cu(t.res_25_log));
-    }
-
+  // Steinhart-Hart conversion using the pre-calculated values
+  static celsius_float_t user_thermistor_steinhart_hart(const user_thermistor_t &t, const raw_adc_t raw) {
     // Maximum ADC value .. take into account the over sampling
     constexpr raw_adc_t adc_max = MAX_RAW_THERMISTOR_VALUE;
     const raw_adc_t adc_raw = constrain(raw, 1, adc_max - 1); // constrain to prevent divide-by-zero
@@ -2598,6 +2631,109 @@ void Temperature::task() {
     // Return degrees C (up to 999, as the LCD only displays 3 digits)
     return _MIN(value + THERMISTOR_ABS_ZERO_C, 999);
   }
+
+  #if ENABLED(USER_THERMISTOR_LUT)
+
+    user_thermistor_lut_t Temperature::user_thermistor_lut[USER_THERMISTORS];
+
+    #define LUT_SUB _BV(USER_THERMISTOR_LUT_BITS)
+
+    /**
+     * Get the table cell for a distance from either end of the raw range.
+     * Cells are one raw step wide up to LUT_SUB, then there are LUT_SUB
+     * cells per octave. Set 'shift' to the log2 of the cell width.
+     */
+    static uint16_t user_thermistor_lut_cell(const uint16_t u, uint8_t &shift) {
+      shift = u < LUT_SUB ? 0 : (sizeof(unsigned int) * 8 - 1 - __builtin_clz(u)) - (USER_THERMISTOR_LUT_BITS);
+      return shift * LUT_SUB + (u >> shift);
+    }
+
+    // Distance from the end of the raw range where a cell starts
+    static uint16_t user_thermistor_lut_start(const uint16_t cell) {
+      if (cell < LUT_SUB) return cell;
+      const uint8_t shift = cell / LUT_SUB - 1;
+      return (cell - shift * LUT_SUB) << shift;
+    }
+
+    static void user_thermistor_lut_build(const user_thermistor_t &t, user_thermistor_lut_t &lut) {
+      for (uint16_t c = 0; c <= user_thermistor_lut_cells; ++c) {
+        const uint16_t u = user_thermistor_lut_start(c);
+        lut.lower[c] = LROUND(user_thermistor_steinhart_hart(t, u) * 16);
+        lut.upper[c] = LROUND(user_thermistor_steinhart_hart(t, MAX_RAW_THERMISTOR_VALUE - u) * 16);
+      }
+    }
+
+    static celsius_float_t user_thermistor_lut_lookup(const user_thermistor_lut_t &lut, const raw_adc_t raw) {
+      constexpr raw_adc_t half = MAX_RAW_THERMISTOR_VALUE / 2 + 1;
+      const bool low = raw < half;
+      const int16_t * const tbl = low ? lut.lower : lut.upper;
+      const uint16_t u = low ? raw : MAX_RAW_THERMISTOR_VALUE - raw;
+      uint8_t shift;
+      const uint16_t c = user_thermistor_lut_cell(u, shift);
+      const int32_t offset = u & (_BV32(shift) - 1),
+                    value = tbl[c] + ((int32_t(tbl[c + 1] - tbl[c]) * offset) >> shift);
+      return value * (1.0f / 16);
+    }
+
+    #undef LUT_SUB
+
+  #endif // USER_THERMISTOR_LUT
+
+  // Update the pre-calculated values after a parameter change
+  static const user_thermistor_t& prepare_user_thermistor(const uint8_t t_index) {
+    user_thermistor_t &t = thermalManager.user_thermistor[t_index];
+    if (t.pre_calc) { // pre-calculate some variables
+      t.pre_calc     = false;
+      t.res_25_recip = 1.0f / t.res_25;
+      t.res_25_log   = logf(t.res_25);
+      t.beta_recip   = 1.0f / t.beta;
+      t.sh_alpha     = RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
+                        - (t.beta_recip * t.res_25_log) - (t.sh_c_coeff * cu(t.res_25_log));
+      TERN_(USER_THERMISTOR_LUT, user_thermistor_lut_build(t, thermalManager.user_thermistor_lut[t_index]));
+    }
+    return t;
+  }
+
+  #if ENABLED(USER_THERMISTOR_LUT)
+
+    /**
+     * Largest difference between the table and Steinhart-Hart, sampled
+     * in the middle of each cell. Cells clamped to 999 are ignored.
+     */
+    float Temperature::user_thermistor_lut_error(const uint8_t t_index) {
+      const user_thermistor_t &t = prepare_user_thermistor(t_index);
+      const user_thermistor_lut_t &lut = user_thermistor_lut[t_index];
+      float err = 0;
+      for (uint16_t c = 0; c < user_thermistor_lut_cells; ++c) {
+        const uint16_t u0 = user_thermistor_lut_start(c), u1 = user_thermistor_lut_start(c + 1);
+        if (u1 - u0 < 2) continue; // Every raw value is an entry
+        const raw_adc_t mid = (u0 + u1) / 2;
+        if (_MAX(lut.lower[c], lut.lower[c + 1]) < 999 * 16)
+          NOLESS(err, ABS(user_thermistor_lut_lookup(lut, mid) - user_thermistor_steinhart_hart(t, mid)));
+        if (_MAX(lut.upper[c], lut.upper[c + 1]) < 999 * 16) {
+          const raw_adc_t raw = MAX_RAW_THERMISTOR_VALUE - mid;
+          NOLESS(err, ABS(user_thermistor_lut_lookup(lut, raw) - user_thermistor_steinhart_hart(t, raw)));
+        }
+      }
+      return err;
+    }
+
+  #endif
+
+  celsius_float_t Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const raw_adc_t raw) {
+
+    if (!WITHIN(t_index, 0, COUNT(user_thermistor) - 1)) return 25;
+
+    const user_thermistor_t &t = prepare_user_thermistor(t_index);
+
+    #if ENABLED(USER_THERMISTOR_LUT)
+      UNUSED(t);
+      return user_thermistor_lut_lookup(user_thermistor_lut[t_index], raw);
+    #else
+      return user_thermistor_steinhart_hart(t, raw);
+    #endif
+  }
+
 #endif
 
 #if HAS_HOTEND
@@ -2725,8 +2861,7 @@ void Temperature::task() {
 
     #if HAS_HOTEND_THERMISTOR
       // Thermistor with conversion table?
-      const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
-      SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      return thermistor_table_celsius(heater_ttbl_map[e], heater_ttbllen_map[e], *heater_tgrid_map[e], raw);
     #endif
 
     return 0;
@@ -2748,7 +2883,7 @@ void Temperature::task() {
         return (int16_t)raw * 0.25f;
       #endif
     #elif TEMP_SENSOR_BED_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_BED, TEMPTABLE_BED_LEN);
+      return thermistor_table_celsius(TEMPTABLE_BED, TEMPTABLE_BED_LEN, tempgrid_bed, raw);
     #elif TEMP_SENSOR_BED_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_BED_IS_AD8495
@@ -2766,7 +2901,7 @@ void Temperature::task() {
     #if TEMP_SENSOR_CHAMBER_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_CHAMBER, raw);
     #elif TEMP_SENSOR_CHAMBER_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_CHAMBER, TEMPTABLE_CHAMBER_LEN);
+      return thermistor_table_celsius(TEMPTABLE_CHAMBER, TEMPTABLE_CHAMBER_LEN, tempgrid_chamber, raw);
     #elif TEMP_SENSOR_CHAMBER_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_CHAMBER_IS_AD8495
@@ -2784,7 +2919,7 @@ void Temperature::task() {
     #if TEMP_SENSOR_COOLER_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_COOLER, raw);
     #elif TEMP_SENSOR_COOLER_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_COOLER, TEMPTABLE_COOLER_LEN);
+      return thermistor_table_celsius(TEMPTABLE_COOLER, TEMPTABLE_COOLER_LEN, tempgrid_cooler, raw);
     #elif TEMP_SENSOR_COOLER_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_COOLER_IS_AD8495
@@ -2802,7 +2937,7 @@ void Temperature::task() {
     #if TEMP_SENSOR_PROBE_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_PROBE, raw);
     #elif TEMP_SENSOR_PROBE_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_PROBE, TEMPTABLE_PROBE_LEN);
+      return thermistor_table_celsius(TEMPTABLE_PROBE, TEMPTABLE_PROBE_LEN, tempgrid_probe, raw);
     #elif TEMP_SENSOR_PROBE_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_PROBE_IS_AD8495
@@ -2820,7 +2955,7 @@ void Temperature::task() {
     #if TEMP_SENSOR_BOARD_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_BOARD, raw);
     #elif TEMP_SENSOR_BOARD_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_BOARD, TEMPTABLE_BOARD_LEN);
+      return thermistor_table_celsius(TEMPTABLE_BOARD, TEMPTABLE_BOARD_LEN, tempgrid_board, raw);
     #elif TEMP_SENSOR_BOARD_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_BOARD_IS_AD8495
@@ -2858,7 +2993,7 @@ void Temperature::task() {
     #elif TEMP_SENSOR_IS_MAX_TC(REDUNDANT) && REDUNDANT_TEMP_MATCH(SOURCE, E2)
       return TERN(TEMP_SENSOR_REDUNDANT_IS_MAX31865, max31865_2.temperature(raw), (int16_t)raw * 0.25f);
     #elif TEMP_SENSOR_REDUNDANT_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_REDUNDANT, TEMPTABLE_REDUNDANT_LEN);
+      return thermistor_table_celsius(TEMPTABLE_REDUNDANT, TEMPTABLE_REDUNDANT_LEN, tempgrid_redundant, raw);
     #elif TEMP_SENSOR_REDUNDANT_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_REDUNDANT_IS_AD8495
@@ -3925,41 +4060,76 @@ void Temperature::disable_all_heaters() {
  */
 void Temperature::update_raw_temperatures() {
 
+  // With ADC_SCAN_MODE the sums come from the scan handoff instead of each sensor
+  #if ENABLED(ADC_SCAN_MODE)
+    #define RAW_UPDATE(T, S) T.setraw(adc_scan.get(ADC_SCAN_INDEX(S)))
+  #else
+    #define RAW_UPDATE(T, S) T.update()
+  #endif
+
   // TODO: can this be collapsed into a HOTEND_LOOP()?
   #if HAS_TEMP_ADC_0 && !TEMP_SENSOR_IS_MAX_TC(0)
-    temp_hotend[0].update();
+    RAW_UPDATE(temp_hotend[0], Temp_0);
   #endif
 
   #if HAS_TEMP_ADC_1 && !TEMP_SENSOR_IS_MAX_TC(1)
-    temp_hotend[1].update();
+    RAW_UPDATE(temp_hotend[1], Temp_1);
   #endif
 
   #if HAS_TEMP_ADC_2 && !TEMP_SENSOR_IS_MAX_TC(2)
-    temp_hotend[2].update();
+    RAW_UPDATE(temp_hotend[2], Temp_2);
   #endif
 
   #if HAS_TEMP_ADC_REDUNDANT && !TEMP_SENSOR_IS_MAX_TC(REDUNDANT)
-    temp_redundant.update();
+    RAW_UPDATE(temp_redundant, Temp_REDUNDANT);
   #endif
 
   #if HAS_TEMP_ADC_BED && !TEMP_SENSOR_IS_MAX_TC(BED)
-    temp_bed.update();
+    RAW_UPDATE(temp_bed, Temp_BED);
+  #endif
+
+  #if HAS_TEMP_ADC_3
+    RAW_UPDATE(temp_hotend[3], Temp_3);
+  #endif
+  #if HAS_TEMP_ADC_4
+    RAW_UPDATE(temp_hotend[4], Temp_4);
+  #endif
+  #if HAS_TEMP_ADC_5
+    RAW_UPDATE(temp_hotend[5], Temp_5);
+  #endif
+  #if HAS_TEMP_ADC_6
+    RAW_UPDATE(temp_hotend[6], Temp_6);
+  #endif
+  #if HAS_TEMP_ADC_7
+    RAW_UPDATE(temp_hotend[7], Temp_7);
+  #endif
+  #if HAS_TEMP_ADC_CHAMBER
+    RAW_UPDATE(temp_chamber, Temp_CHAMBER);
+  #endif
+  #if HAS_TEMP_ADC_PROBE
+    RAW_UPDATE(temp_probe, Temp_PROBE);
+  #endif
+  #if HAS_TEMP_ADC_COOLER
+    RAW_UPDATE(temp_cooler, Temp_COOLER);
+  #endif
+  #if HAS_TEMP_ADC_BOARD
+    RAW_UPDATE(temp_board, Temp_BOARD);
+  #endif
+  #if HAS_TEMP_ADC_SOC
+    RAW_UPDATE(temp_soc, Temp_SOC);
+  #endif
+
+  #if HAS_JOY_ADC_X
+    RAW_UPDATE(joystick.x, Joy_X);
+  #endif
+  #if HAS_JOY_ADC_Y
+    RAW_UPDATE(joystick.y, Joy_Y);
+  #endif
+  #if HAS_JOY_ADC_Z
+    RAW_UPDATE(joystick.z, Joy_Z);
   #endif
 
-  TERN_(HAS_TEMP_ADC_3,       temp_hotend[3].update());
-  TERN_(HAS_TEMP_ADC_4,       temp_hotend[4].update());
-  TERN_(HAS_TEMP_ADC_5,       temp_hotend[5].update());
-  TERN_(HAS_TEMP_ADC_6,       temp_hotend[6].update());
-  TERN_(HAS_TEMP_ADC_7,       temp_hotend[7].update());
-  TERN_(HAS_TEMP_ADC_CHAMBER, temp_chamber.update());
-  TERN_(HAS_TEMP_ADC_PROBE,   temp_probe.update());
-  TERN_(HAS_TEMP_ADC_COOLER,  temp_cooler.update());
-  TERN_(HAS_TEMP_ADC_BOARD,   temp_board.update());
-  TERN_(HAS_TEMP_ADC_SOC,     temp_soc.update());
-
-  TERN_(HAS_JOY_ADC_X, joystick.x.update());
-  TERN_(HAS_JOY_ADC_Y, joystick.y.update());
-  TERN_(HAS_JOY_ADC_Z, joystick.z.update());
+  #undef RAW_UPDATE
 }
 
 /**
@@ -4062,8 +4232,10 @@ void Temperature::isr() {
     }
   #endif
 
-  static int8_t temp_count = -1;
-  static ADCSensorState adc_sensor_state = StartupDelay;
+  #if DISABLED(ADC_SCAN_MODE)
+    static int8_t temp_count = -1;
+    static ADCSensorState adc_sensor_state = StartupDelay;
+  #endif
 
   #ifndef SOFT_PWM_SCALE
     #define SOFT_PWM_SCALE 0
@@ -4074,28 +4246,53 @@ void Temperature::isr() {
   uint8_t pwm_count_tmp = pwm_count;
 
   #if HAS_ADC_BUTTONS
-    static raw_adc_t raw_ADCKey_value = 0;
     static bool ADCKey_pressed = false;
-  #endif
 
-  #if HAS_HOTEND
-    static SoftPWM soft_pwm_hotend[HOTENDS];
-  #endif
+    #ifndef ADC_BUTTON_DEBOUNCE_DELAY
+      #define ADC_BUTTON_DEBOUNCE_DELAY 16
+    #endif
 
-  #if HAS_HEATED_BED
-    static SoftPWM soft_pwm_bed;
+    // Debounce a reading of the ADC keypad
+    auto sample_adc_key = [](const raw_adc_t raw_ADCKey_value) {
+      if (ADCKey_count < ADC_BUTTON_DEBOUNCE_DELAY) {
+        if (raw_ADCKey_value <= 900UL * HAL_ADC_RANGE / 1024UL) {
+          NOMORE(current_ADCKey_raw, raw_ADCKey_value);
+          ADCKey_count++;
+        }
+        else { //ADC Key release
+          if (ADCKey_count > 0) ADCKey_count++; else ADCKey_pressed = false;
+          if (ADCKey_pressed) {
+            ADCKey_count = 0;
+            current_ADCKey_raw = HAL_ADC_RANGE;
+          }
+        }
+      }
+      if (ADCKey_count == ADC_BUTTON_DEBOUNCE_DELAY) ADCKey_pressed = true;
+    };
   #endif
 
-  #if HAS_HEATED_CHAMBER
-    static SoftPWM soft_pwm_chamber;
-  #endif
+  #if DISABLED(SOFT_PWM_SCHEDULE)
 
-  #if HAS_COOLER
-    static SoftPWM soft_pwm_cooler;
-  #endif
+    #if HAS_HOTEND
+      static SoftPWM soft_pwm_hotend[HOTENDS];
+    #endif
+
+    #if HAS_HEATED_BED
+      static SoftPWM soft_pwm_bed;
+    #endif
+
+    #if HAS_HEATED_CHAMBER
+      static SoftPWM soft_pwm_chamber;
+    #endif
+
+    #if HAS_COOLER
+      static SoftPWM soft_pwm_cooler;
+    #endif
+
+    #if ALL(FAN_SOFT_PWM, USE_CONTROLLER_FAN)
+      static SoftPWM soft_pwm_controller;
+    #endif
 
-  #if ALL(FAN_SOFT_PWM, USE_CONTROLLER_FAN)
-    static SoftPWM soft_pwm_controller;
   #endif
 
   #define WRITE_FAN(n, v) WRITE(FAN##n##_PIN, (v) ^ ENABLED(FAN_INVERTING))
@@ -4110,119 +4307,231 @@ void Temperature::isr() {
       }while(0)
     #endif
 
-    /**
-     * Standard heater PWM modulation
-     */
-    if (pwm_count_tmp >= 127) {
-      pwm_count_tmp -= 127;
+    #if ENABLED(SOFT_PWM_SCHEDULE)
+
+      #if ANY(HAS_HOTEND, HAS_HEATED_BED, HAS_HEATED_CHAMBER, HAS_COOLER, FAN_SOFT_PWM)
+
+        /**
+         * Heater and fan PWM modulation from a schedule of the outputs in the order they turn off
+         */
+        enum SoftPWMOutput : uint8_t {
+          #define _PWM_E(N) PWM_E##N,
+          REPEAT(HOTENDS, _PWM_E)
+          OPTITEM(HAS_HEATED_BED, PWM_BED)
+          OPTITEM(HAS_HEATED_CHAMBER, PWM_CHAMBER)
+          OPTITEM(HAS_COOLER, PWM_COOLER)
+          #if ENABLED(FAN_SOFT_PWM)
+            OPTITEM(HAS_FAN0, PWM_FAN0)
+            OPTITEM(HAS_FAN1, PWM_FAN1)
+            OPTITEM(HAS_FAN2, PWM_FAN2)
+            OPTITEM(HAS_FAN3, PWM_FAN3)
+            OPTITEM(HAS_FAN4, PWM_FAN4)
+            OPTITEM(HAS_FAN5, PWM_FAN5)
+            OPTITEM(HAS_FAN6, PWM_FAN6)
+            OPTITEM(HAS_FAN7, PWM_FAN7)
+            OPTITEM(USE_CONTROLLER_FAN, PWM_CONTROLLER)
+          #endif
+          SOFT_PWM_OUTPUTS
+        };
 
-      #if HAS_HOTEND
-        #define _PWM_MOD_E(N) _PWM_MOD(N,soft_pwm_hotend[N],temp_hotend[N]);
-        REPEAT(HOTENDS, _PWM_MOD_E);
-      #endif
+        static SoftPWMSchedule<SOFT_PWM_OUTPUTS> soft_pwm_schedule;
 
-      #if HAS_HEATED_BED
-        _PWM_MOD(BED, soft_pwm_bed, temp_bed);
-        #if ENABLED(PELTIER_BED)
-          WRITE_PELTIER_DIR(temp_bed.peltier_dir_heating);
-        #endif
-      #endif
+        auto write_soft_pwm = [](const uint8_t out, const bool on) {
+          switch (out) {
+            #define _PWM_WRITE_E(N) case PWM_E##N: WRITE_HEATER_##N(on); break;
+            REPEAT(HOTENDS, _PWM_WRITE_E)
+            #if HAS_HEATED_BED
+              case PWM_BED: WRITE_HEATER_BED(on); break;
+            #endif
+            #if HAS_HEATED_CHAMBER
+              case PWM_CHAMBER: WRITE_HEATER_CHAMBER(on); break;
+            #endif
+            #if HAS_COOLER
+              case PWM_COOLER: WRITE_HEATER_COOLER(on); break;
+            #endif
+            #if ENABLED(FAN_SOFT_PWM)
+              #if HAS_FAN0
+                case PWM_FAN0: WRITE_FAN(0, on); break;
+              #endif
+              #if HAS_FAN1
+                case PWM_FAN1: WRITE_FAN(1, on); break;
+              #endif
+              #if HAS_FAN2
+                case PWM_FAN2: WRITE_FAN(2, on); break;
+              #endif
+              #if HAS_FAN3
+                case PWM_FAN3: WRITE_FAN(3, on); break;
+              #endif
+              #if HAS_FAN4
+                case PWM_FAN4: WRITE_FAN(4, on); break;
+              #endif
+              #if HAS_FAN5
+                case PWM_FAN5: WRITE_FAN(5, on); break;
+              #endif
+              #if HAS_FAN6
+                case PWM_FAN6: WRITE_FAN(6, on); break;
+              #endif
+              #if HAS_FAN7
+                case PWM_FAN7: WRITE_FAN(7, on); break;
+              #endif
+              #if ENABLED(USE_CONTROLLER_FAN)
+                case PWM_CONTROLLER: WRITE(CONTROLLER_FAN_PIN, on); break;
+              #endif
+            #endif
+          }
+        };
 
-      #if HAS_HEATED_CHAMBER
-        _PWM_MOD(CHAMBER, soft_pwm_chamber, temp_chamber);
-      #endif
+        if (pwm_count_tmp >= 127) {
+          pwm_count_tmp -= 127;
+
+          const uint8_t amount[SOFT_PWM_OUTPUTS] = {
+            #define _PWM_AMOUNT_E(N) temp_hotend[N].soft_pwm_amount,
+            REPEAT(HOTENDS, _PWM_AMOUNT_E)
+            OPTITEM(HAS_HEATED_BED, temp_bed.soft_pwm_amount)
+            OPTITEM(HAS_HEATED_CHAMBER, temp_chamber.soft_pwm_amount)
+            OPTITEM(HAS_COOLER, temp_cooler.soft_pwm_amount)
+            #if ENABLED(FAN_SOFT_PWM)
+              OPTITEM(HAS_FAN0, uint8_t(soft_pwm_amount_fan[0] >> 1))
+              OPTITEM(HAS_FAN1, uint8_t(soft_pwm_amount_fan[1] >> 1))
+              OPTITEM(HAS_FAN2, uint8_t(soft_pwm_amount_fan[2] >> 1))
+              OPTITEM(HAS_FAN3, uint8_t(soft_pwm_amount_fan[3] >> 1))
+              OPTITEM(HAS_FAN4, uint8_t(soft_pwm_amount_fan[4] >> 1))
+              OPTITEM(HAS_FAN5, uint8_t(soft_pwm_amount_fan[5] >> 1))
+              OPTITEM(HAS_FAN6, uint8_t(soft_pwm_amount_fan[6] >> 1))
+              OPTITEM(HAS_FAN7, uint8_t(soft_pwm_amount_fan[7] >> 1))
+              OPTITEM(USE_CONTROLLER_FAN, controllerFan.soft_pwm_speed)
+            #endif
+          };
+          soft_pwm_schedule.start(pwm_mask, amount, write_soft_pwm);
 
-      #if HAS_COOLER
-        _PWM_MOD(COOLER, soft_pwm_cooler, temp_cooler);
-      #endif
+          #if ENABLED(PELTIER_BED)
+            WRITE_PELTIER_DIR(temp_bed.peltier_dir_heating);
+          #endif
+        }
+        else
+          soft_pwm_schedule.run(pwm_count_tmp, write_soft_pwm);
 
-      #if ENABLED(FAN_SOFT_PWM)
+      #else
+        if (pwm_count_tmp >= 127) pwm_count_tmp -= 127;
+      #endif
 
-        #if ENABLED(USE_CONTROLLER_FAN)
-          WRITE(CONTROLLER_FAN_PIN, soft_pwm_controller.add(pwm_mask, controllerFan.soft_pwm_speed));
-        #endif
+    #else // !SOFT_PWM_SCHEDULE
 
-        #define _FAN_PWM(N) do{                                     \
-          uint8_t &spcf = soft_pwm_count_fan[N];                    \
-          spcf = (spcf & pwm_mask) + (soft_pwm_amount_fan[N] >> 1); \
-          WRITE_FAN(N, spcf > pwm_mask ? HIGH : LOW);               \
-        }while(0)
+      /**
+       * Standard heater PWM modulation
+       */
+      if (pwm_count_tmp >= 127) {
+        pwm_count_tmp -= 127;
 
-        #if HAS_FAN0
-          _FAN_PWM(0);
+        #if HAS_HOTEND
+          #define _PWM_MOD_E(N) _PWM_MOD(N,soft_pwm_hotend[N],temp_hotend[N]);
+          REPEAT(HOTENDS, _PWM_MOD_E);
         #endif
-        #if HAS_FAN1
-          _FAN_PWM(1);
-        #endif
-        #if HAS_FAN2
-          _FAN_PWM(2);
-        #endif
-        #if HAS_FAN3
-          _FAN_PWM(3);
-        #endif
-        #if HAS_FAN4
-          _FAN_PWM(4);
-        #endif
-        #if HAS_FAN5
-          _FAN_PWM(5);
+
+        #if HAS_HEATED_BED
+          _PWM_MOD(BED, soft_pwm_bed, temp_bed);
+          #if ENABLED(PELTIER_BED)
+            WRITE_PELTIER_DIR(temp_bed.peltier_dir_heating);
+          #endif
         #endif
-        #if HAS_FAN6
-          _FAN_PWM(6);
+
+        #if HAS_HEATED_CHAMBER
+          _PWM_MOD(CHAMBER, soft_pwm_chamber, temp_chamber);
         #endif
-        #if HAS_FAN7
-          _FAN_PWM(7);
+
+        #if HAS_COOLER
+          _PWM_MOD(COOLER, soft_pwm_cooler, temp_cooler);
         #endif
-      #endif
-    }
-    else {
-      #define _PWM_LOW(N,S) do{ if (S.count <= pwm_count_tmp) WRITE_HEATER_##N(LOW); }while(0)
-      #if HAS_HOTEND
-        #define _PWM_LOW_E(N) _PWM_LOW(N, soft_pwm_hotend[N]);
-        REPEAT(HOTENDS, _PWM_LOW_E);
-      #endif
 
-      #if HAS_HEATED_BED
-        _PWM_LOW(BED, soft_pwm_bed);
-      #endif
+        #if ENABLED(FAN_SOFT_PWM)
 
-      #if HAS_HEATED_CHAMBER
-        _PWM_LOW(CHAMBER, soft_pwm_chamber);
-      #endif
+          #if ENABLED(USE_CONTROLLER_FAN)
+            WRITE(CONTROLLER_FAN_PIN, soft_pwm_controller.add(pwm_mask, controllerFan.soft_pwm_speed));
+          #endif
 
-      #if HAS_COOLER
-        _PWM_LOW(COOLER, soft_pwm_cooler);
-      #endif
+          #define _FAN_PWM(N) do{                                     \
+            uint8_t &spcf = soft_pwm_count_fan[N];                    \
+            spcf = (spcf & pwm_mask) + (soft_pwm_amount_fan[N] >> 1); \
+            WRITE_FAN(N, spcf > pwm_mask ? HIGH : LOW);               \
+          }while(0)
 
-      #if ENABLED(FAN_SOFT_PWM)
-        #if HAS_FAN0
-          if (soft_pwm_count_fan[0] <= pwm_count_tmp) WRITE_FAN(0, LOW);
-        #endif
-        #if HAS_FAN1
-          if (soft_pwm_count_fan[1] <= pwm_count_tmp) WRITE_FAN(1, LOW);
-        #endif
-        #if HAS_FAN2
-          if (soft_pwm_count_fan[2] <= pwm_count_tmp) WRITE_FAN(2, LOW);
-        #endif
-        #if HAS_FAN3
-          if (soft_pwm_count_fan[3] <= pwm_count_tmp) WRITE_FAN(3, LOW);
+          #if HAS_FAN0
+            _FAN_PWM(0);
+          #endif
+          #if HAS_FAN1
+            _FAN_PWM(1);
+          #endif
+          #if HAS_FAN2
+            _FAN_PWM(2);
+          #endif
+          #if HAS_FAN3
+            _FAN_PWM(3);
+          #endif
+          #if HAS_FAN4
+            _FAN_PWM(4);
+          #endif
+          #if HAS_FAN5
+            _FAN_PWM(5);
+          #endif
+          #if HAS_FAN6
+            _FAN_PWM(6);
+          #endif
+          #if HAS_FAN7
+            _FAN_PWM(7);
+          #endif
         #endif
-        #if HAS_FAN4
-          if (soft_pwm_count_fan[4] <= pwm_count_tmp) WRITE_FAN(4, LOW);
+      }
+      else {
+        #define _PWM_LOW(N,S) do{ if (S.count <= pwm_count_tmp) WRITE_HEATER_##N(LOW); }while(0)
+        #if HAS_HOTEND
+          #define _PWM_LOW_E(N) _PWM_LOW(N, soft_pwm_hotend[N]);
+          REPEAT(HOTENDS, _PWM_LOW_E);
         #endif
-        #if HAS_FAN5
-          if (soft_pwm_count_fan[5] <= pwm_count_tmp) WRITE_FAN(5, LOW);
+
+        #if HAS_HEATED_BED
+          _PWM_LOW(BED, soft_pwm_bed);
         #endif
-        #if HAS_FAN6
-          if (soft_pwm_count_fan[6] <= pwm_count_tmp) WRITE_FAN(6, LOW);
+
+        #if HAS_HEATED_CHAMBER
+          _PWM_LOW(CHAMBER, soft_pwm_chamber);
         #endif
-        #if HAS_FAN7
-          if (soft_pwm_count_fan[7] <= pwm_count_tmp) WRITE_FAN(7, LOW);
+
+        #if HAS_COOLER
+          _PWM_LOW(COOLER, soft_pwm_cooler);
         #endif
-        #if ENABLED(USE_CONTROLLER_FAN)
-          if (soft_pwm_controller.count <= pwm_count_tmp) WRITE(CONTROLLER_FAN_PIN, LOW);
+
+        #if ENABLED(FAN_SOFT_PWM)
+          #if HAS_FAN0
+            if (soft_pwm_count_fan[0] <= pwm_count_tmp) WRITE_FAN(0, LOW);
+          #endif
+          #if HAS_FAN1
+            if (soft_pwm_count_fan[1] <= pwm_count_tmp) WRITE_FAN(1, LOW);
+          #endif
+          #if HAS_FAN2
+            if (soft_pwm_count_fan[2] <= pwm_count_tmp) WRITE_FAN(2, LOW);
+          #endif
+          #if HAS_FAN3
+            if (soft_pwm_count_fan[3] <= pwm_count_tmp) WRITE_FAN(3, LOW);
+          #endif
+          #if HAS_FAN4
+            if (soft_pwm_count_fan[4] <= pwm_count_tmp) WRITE_FAN(4, LOW);
+          #endif
+          #if HAS_FAN5
+            if (soft_pwm_count_fan[5] <= pwm_count_tmp) WRITE_FAN(5, LOW);
+          #endif
+          #if HAS_FAN6
+            if (soft_pwm_count_fan[6] <= pwm_count_tmp) WRITE_FAN(6, LOW);
+          #endif
+          #if HAS_FAN7
+            if (soft_pwm_count_fan[7] <= pwm_count_tmp) WRITE_FAN(7, LOW);
+          #endif
+          #if ENABLED(USE_CONTROLLER_FAN)
+            if (soft_pwm_controller.count <= pwm_count_tmp) WRITE(CONTROLLER_FAN_PIN, LOW);
+          #endif
         #endif
-      #endif
-    }
+      }
+
+    #endif // !SOFT_PWM_SCHEDULE
 
     // SOFT_PWM_SCALE to frequency:
     //
@@ -4380,205 +4689,258 @@ void Temperature::isr() {
   #endif
   if (do_buttons) ui.update_buttons();
 
-  /**
-   * One sensor is sampled on every other call of the ISR.
-   * Each sensor is read 16 (OVERSAMPLENR) times, taking the average.
-   *
-   * On each Prepare pass, ADC is started for a sensor pin.
-   * On the next pass, the ADC value is read and accumulated.
-   *
-   * This gives each ADC 0.9765ms to charge up.
-   */
-  #define ACCUMULATE_ADC(obj) do{ \
-    if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; \
-    else obj.sample(hal.adc_value()); \
-  }while(0)
+  #if ENABLED(ADC_SCAN_MODE)
 
-  ADCSensorState next_sensor_state = adc_sensor_state < SensorsReady ? (ADCSensorState)(int(adc_sensor_state) + 1) : StartSampling;
+    /**
+     * All sensors are sampled in a single scan on every call of the ISR.
+     * Each sensor is read 16 (OVERSAMPLENR) times, and the sums are handed
+     * to update_raw_temperatures as a set.
+     *
+     * A scan is started on one pass and collected on the next, giving the
+     * HAL a whole ISR period to convert all the channels.
+     */
+    static const pin_t adc_scan_pins[] = {
+      OPTITEM(HAS_TEMP_ADC_0,        TEMP_0_PIN)
+      OPTITEM(HAS_TEMP_ADC_BED,      TEMP_BED_PIN)
+      OPTITEM(HAS_TEMP_ADC_CHAMBER,  TEMP_CHAMBER_PIN)
+      OPTITEM(HAS_TEMP_ADC_COOLER,   TEMP_COOLER_PIN)
+      OPTITEM(HAS_TEMP_ADC_PROBE,    TEMP_PROBE_PIN)
+      OPTITEM(HAS_TEMP_ADC_BOARD,    TEMP_BOARD_PIN)
+      OPTITEM(HAS_TEMP_ADC_SOC,      TEMP_SOC_PIN)
+      OPTITEM(HAS_TEMP_ADC_REDUNDANT, TEMP_REDUNDANT_PIN)
+      OPTITEM(HAS_TEMP_ADC_1,        TEMP_1_PIN)
+      OPTITEM(HAS_TEMP_ADC_2,        TEMP_2_PIN)
+      OPTITEM(HAS_TEMP_ADC_3,        TEMP_3_PIN)
+      OPTITEM(HAS_TEMP_ADC_4,        TEMP_4_PIN)
+      OPTITEM(HAS_TEMP_ADC_5,        TEMP_5_PIN)
+      OPTITEM(HAS_TEMP_ADC_6,        TEMP_6_PIN)
+      OPTITEM(HAS_TEMP_ADC_7,        TEMP_7_PIN)
+      OPTITEM(HAS_JOY_ADC_X,         JOY_X_PIN)
+      OPTITEM(HAS_JOY_ADC_Y,         JOY_Y_PIN)
+      OPTITEM(HAS_JOY_ADC_Z,         JOY_Z_PIN)
+      OPTITEM(FILAMENT_WIDTH_SENSOR, FILWIDTH_PIN)
+      OPTITEM(POWER_MONITOR_CURRENT, POWER_MONITOR_CURRENT_PIN)
+      OPTITEM(POWER_MONITOR_VOLTAGE, POWER_MONITOR_VOLTAGE_PIN)
+      OPTITEM(HAS_ADC_BUTTONS,       ADC_KEYPAD_PIN)
+    };
+    static_assert(COUNT(adc_scan_pins) == ADC_SCAN_CHANNELS, "adc_scan_pins must follow the order of ADCSensorState.");
 
-  switch (adc_sensor_state) {
+    static uint16_t adc_scan_values[ADC_SCAN_CHANNELS];
+    static bool adc_scanning; // = false
 
-    #pragma GCC diagnostic push
-    #if __has_cpp_attribute(fallthrough)
-      #pragma GCC diagnostic ignored "-Wimplicit-fallthrough"
-    #endif
+    if (!adc_scanning || hal.adc_scan_ready()) {
+      if (adc_scanning) {
+        #define ADC_SCAN_VALUE(S) adc_scan_values[ADC_SCAN_INDEX(S)]
 
-    case SensorsReady: {
-      // All sensors have been read. Stay in this state for a few
-      // ISRs to save on calls to temp update/checking code below.
-      constexpr int8_t extra_loops = MIN_ADC_ISR_LOOPS - (int8_t)SensorsReady;
-      static uint8_t delay_count = 0;
-      if (extra_loops > 0) {
-        if (delay_count == 0) delay_count = extra_loops;  // Init this delay
-        if (--delay_count)                                // While delaying...
-          next_sensor_state = SensorsReady;               // retain this state (else, next state will be 0)
-        break;
-      }
-      else {
-        adc_sensor_state = StartSampling;                 // Fall-through to start sampling
-        next_sensor_state = (ADCSensorState)(int(StartSampling) + 1);
+        if (adc_scan.add(adc_scan_values)) {
+          // Filament Sensor - can be read any time since IIR filtering is used
+          TERN_(FILAMENT_WIDTH_SENSOR, filwidth.reading_ready());
+        }
+
+        TERN_(FILAMENT_WIDTH_SENSOR, filwidth.accumulate(ADC_SCAN_VALUE(_FILWIDTH)));
+        TERN_(POWER_MONITOR_CURRENT, power_monitor.add_current_sample(ADC_SCAN_VALUE(_POWER_MONITOR_CURRENT)));
+        TERN_(POWER_MONITOR_VOLTAGE, power_monitor.add_voltage_sample(ADC_SCAN_VALUE(_POWER_MONITOR_VOLTAGE)));
+
+        #if HAS_ADC_BUTTONS
+          // Read the keypad about as often as without ADC_SCAN_MODE to keep the same debounce time
+          static uint8_t adc_key_loops = 0;
+          if (++adc_key_loops >= MIN_ADC_ISR_LOOPS) {
+            adc_key_loops = 0;
+            sample_adc_key(ADC_SCAN_VALUE(_ADC_KEY));
+          }
+        #endif
       }
+      hal.adc_scan_start(adc_scan_pins, adc_scan_values, ADC_SCAN_CHANNELS);
+      adc_scanning = true;
     }
 
-    #pragma GCC diagnostic pop
+  #else // !ADC_SCAN_MODE
+
+    /**
+     * One sensor is sampled on every other call of the ISR.
+     * Each sensor is read 16 (OVERSAMPLENR) times, taking the average.
+     *
+     * On each Prepare pass, ADC is started for a sensor pin.
+     * On the next pass, the ADC value is read and accumulated.
+     *
+     * This gives each ADC 0.9765ms to charge up.
+     */
+    #define ACCUMULATE_ADC(obj) do{ \
+      if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; \
+      else obj.sample(hal.adc_value()); \
+    }while(0)
+
+    ADCSensorState next_sensor_state = adc_sensor_state < SensorsReady ? (ADCSensorState)(int(adc_sensor_state) + 1) : StartSampling;
+
+    switch (adc_sensor_state) {
+
+      #pragma GCC diagnostic push
+      #if __has_cpp_attribute(fallthrough)
+        #pragma GCC diagnostic ignored "-Wimplicit-fallthrough"
+      #endif
 
-    case StartSampling:                                   // Start of sampling loops. Do updates/checks.
-      if (++temp_count >= OVERSAMPLENR) {                 // 10 * 16 * 1/(16000000/64/256)  = 164ms.
-        temp_count = 0;
-        readings_ready();
+      case SensorsReady: {
+        // All sensors have been read. Stay in this state for a few
+        // ISRs to save on calls to temp update/checking code below.
+        constexpr int8_t extra_loops = MIN_ADC_ISR_LOOPS - (int8_t)SensorsReady;
+        static uint8_t delay_count = 0;
+        if (extra_loops > 0) {
+          if (delay_count == 0) delay_count = extra_loops;  // Init this delay
+          if (--delay_count)                                // While delaying...
+            next_sensor_state = SensorsReady;               // retain this state (else, next state will be 0)
+          break;
+        }
+        else {
+          adc_sensor_state = StartSampling;                 // Fall-through to start sampling
+          next_sensor_state = (ADCSensorState)(int(StartSampling) + 1);
+        }
       }
-      break;
 
-    #if HAS_TEMP_ADC_0
-      case PrepareTemp_0: hal.adc_start(TEMP_0_PIN); break;
-      case MeasureTemp_0: ACCUMULATE_ADC(temp_hotend[0]); break;
-    #endif
+      #pragma GCC diagnostic pop
 
-    #if HAS_TEMP_ADC_BED
-      case PrepareTemp_BED: hal.adc_start(TEMP_BED_PIN); break;
-      case MeasureTemp_BED: ACCUMULATE_ADC(temp_bed); break;
-    #endif
+      case StartSampling:                                   // Start of sampling loops. Do updates/checks.
+        if (++temp_count >= OVERSAMPLENR) {                 // 10 * 16 * 1/(16000000/64/256)  = 164ms.
+          temp_count = 0;
+          readings_ready();
+        }
+        break;
 
-    #if HAS_TEMP_ADC_CHAMBER
-      case PrepareTemp_CHAMBER: hal.adc_start(TEMP_CHAMBER_PIN); break;
-      case MeasureTemp_CHAMBER: ACCUMULATE_ADC(temp_chamber); break;
-    #endif
+      #if HAS_TEMP_ADC_0
+        case PrepareTemp_0: hal.adc_start(TEMP_0_PIN); break;
+        case MeasureTemp_0: ACCUMULATE_ADC(temp_hotend[0]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_COOLER
-      case PrepareTemp_COOLER: hal.adc_start(TEMP_COOLER_PIN); break;
-      case MeasureTemp_COOLER: ACCUMULATE_ADC(temp_cooler); break;
-    #endif
+      #if HAS_TEMP_ADC_BED
+        case PrepareTemp_BED: hal.adc_start(TEMP_BED_PIN); break;
+        case MeasureTemp_BED: ACCUMULATE_ADC(temp_bed); break;
+      #endif
 
-    #if HAS_TEMP_ADC_PROBE
-      case PrepareTemp_PROBE: hal.adc_start(TEMP_PROBE_PIN); break;
-      case MeasureTemp_PROBE: ACCUMULATE_ADC(temp_probe); break;
-    #endif
+      #if HAS_TEMP_ADC_CHAMBER
+        case PrepareTemp_CHAMBER: hal.adc_start(TEMP_CHAMBER_PIN); break;
+        case MeasureTemp_CHAMBER: ACCUMULATE_ADC(temp_chamber); break;
+      #endif
 
-    #if HAS_TEMP_ADC_BOARD
-      case PrepareTemp_BOARD: hal.adc_start(TEMP_BOARD_PIN); break;
-      case MeasureTemp_BOARD: ACCUMULATE_ADC(temp_board); break;
-    #endif
+      #if HAS_TEMP_ADC_COOLER
+        case PrepareTemp_COOLER: hal.adc_start(TEMP_COOLER_PIN); break;
+        case MeasureTemp_COOLER: ACCUMULATE_ADC(temp_cooler); break;
+      #endif
 
-    #if HAS_TEMP_ADC_SOC
-      case PrepareTemp_SOC: hal.adc_start(TEMP_SOC_PIN); break;
-      case MeasureTemp_SOC: ACCUMULATE_ADC(temp_soc); break;
-    #endif
+      #if HAS_TEMP_ADC_PROBE
+        case PrepareTemp_PROBE: hal.adc_start(TEMP_PROBE_PIN); break;
+        case MeasureTemp_PROBE: ACCUMULATE_ADC(temp_probe); break;
+      #endif
 
-    #if HAS_TEMP_ADC_REDUNDANT
-      case PrepareTemp_REDUNDANT: hal.adc_start(TEMP_REDUNDANT_PIN); break;
-      case MeasureTemp_REDUNDANT: ACCUMULATE_ADC(temp_redundant); break;
-    #endif
+      #if HAS_TEMP_ADC_BOARD
+        case PrepareTemp_BOARD: hal.adc_start(TEMP_BOARD_PIN); break;
+        case MeasureTemp_BOARD: ACCUMULATE_ADC(temp_board); break;
+      #endif
 
-    #if HAS_TEMP_ADC_1
-      case PrepareTemp_1: hal.adc_start(TEMP_1_PIN); break;
-      case MeasureTemp_1: ACCUMULATE_ADC(temp_hotend[1]); break;
-    #endif
+      #if HAS_TEMP_ADC_SOC
+        case PrepareTemp_SOC: hal.adc_start(TEMP_SOC_PIN); break;
+        case MeasureTemp_SOC: ACCUMULATE_ADC(temp_soc); break;
+      #endif
 
-    #if HAS_TEMP_ADC_2
-      case PrepareTemp_2: hal.adc_start(TEMP_2_PIN); break;
-      case MeasureTemp_2: ACCUMULATE_ADC(temp_hotend[2]); break;
-    #endif
+      #if HAS_TEMP_ADC_REDUNDANT
+        case PrepareTemp_REDUNDANT: hal.adc_start(TEMP_REDUNDANT_PIN); break;
+        case MeasureTemp_REDUNDANT: ACCUMULATE_ADC(temp_redundant); break;
+      #endif
 
-    #if HAS_TEMP_ADC_3
-      case PrepareTemp_3: hal.adc_start(TEMP_3_PIN); break;
-      case MeasureTemp_3: ACCUMULATE_ADC(temp_hotend[3]); break;
-    #endif
+      #if HAS_TEMP_ADC_1
+        case PrepareTemp_1: hal.adc_start(TEMP_1_PIN); break;
+        case MeasureTemp_1: ACCUMULATE_ADC(temp_hotend[1]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_4
-      case PrepareTemp_4: hal.adc_start(TEMP_4_PIN); break;
-      case MeasureTemp_4: ACCUMULATE_ADC(temp_hotend[4]); break;
-    #endif
+      #if HAS_TEMP_ADC_2
+        case PrepareTemp_2: hal.adc_start(TEMP_2_PIN); break;
+        case MeasureTemp_2: ACCUMULATE_ADC(temp_hotend[2]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_5
-      case PrepareTemp_5: hal.adc_start(TEMP_5_PIN); break;
-      case MeasureTemp_5: ACCUMULATE_ADC(temp_hotend[5]); break;
-    #endif
+      #if HAS_TEMP_ADC_3
+        case PrepareTemp_3: hal.adc_start(TEMP_3_PIN); break;
+        case MeasureTemp_3: ACCUMULATE_ADC(temp_hotend[3]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_6
-      case PrepareTemp_6: hal.adc_start(TEMP_6_PIN); break;
-      case MeasureTemp_6: ACCUMULATE_ADC(temp_hotend[6]); break;
-    #endif
+      #if HAS_TEMP_ADC_4
+        case PrepareTemp_4: hal.adc_start(TEMP_4_PIN); break;
+        case MeasureTemp_4: ACCUMULATE_ADC(temp_hotend[4]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_7
-      case PrepareTemp_7: hal.adc_start(TEMP_7_PIN); break;
-      case MeasureTemp_7: ACCUMULATE_ADC(temp_hotend[7]); break;
-    #endif
+      #if HAS_TEMP_ADC_5
+        case PrepareTemp_5: hal.adc_start(TEMP_5_PIN); break;
+        case MeasureTemp_5: ACCUMULATE_ADC(temp_hotend[5]); break;
+      #endif
 
-    #if ENABLED(FILAMENT_WIDTH_SENSOR)
-      case Prepare_FILWIDTH: hal.adc_start(FILWIDTH_PIN); break;
-      case Measure_FILWIDTH:
-        if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; // Redo this state
-        else filwidth.accumulate(hal.adc_value());
-      break;
-    #endif
+      #if HAS_TEMP_ADC_6
+        case PrepareTemp_6: hal.adc_start(TEMP_6_PIN); break;
+        case MeasureTemp_6: ACCUMULATE_ADC(temp_hotend[6]); break;
+      #endif
 
-    #if ENABLED(POWER_MONITOR_CURRENT)
-      case Prepare_POWER_MONITOR_CURRENT:
-        hal.adc_start(POWER_MONITOR_CURRENT_PIN);
-        break;
-      case Measure_POWER_MONITOR_CURRENT:
-        if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; // Redo this state
-        else power_monitor.add_current_sample(hal.adc_value());
-        break;
-    #endif
+      #if HAS_TEMP_ADC_7
+        case PrepareTemp_7: hal.adc_start(TEMP_7_PIN); break;
+        case MeasureTemp_7: ACCUMULATE_ADC(temp_hotend[7]); break;
+      #endif
 
-    #if ENABLED(POWER_MONITOR_VOLTAGE)
-      case Prepare_POWER_MONITOR_VOLTAGE:
-        hal.adc_start(POWER_MONITOR_VOLTAGE_PIN);
-        break;
-      case Measure_POWER_MONITOR_VOLTAGE:
-        if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; // Redo this state
-        else power_monitor.add_voltage_sample(hal.adc_value());
+      #if ENABLED(FILAMENT_WIDTH_SENSOR)
+        case Prepare_FILWIDTH: hal.adc_start(FILWIDTH_PIN); break;
+        case Measure_FILWIDTH:
+          if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; // Redo this state
+          else filwidth.accumulate(hal.adc_value());
         break;
-    #endif
+      #endif
 
-    #if HAS_JOY_ADC_X
-      case PrepareJoy_X: hal.adc_start(JOY_X_PIN); break;
-      case MeasureJoy_X: ACCUMULATE_ADC(joystick.x); break;
-    #endif
+      #if ENABLED(POWER_MONITOR_CURRENT)
+        case Prepare_POWER_MONITOR_CURRENT:
+          hal.adc_start(POWER_MONITOR_CURRENT_PIN);
+          break;
+        case Measure_POWER_MONITOR_CURRENT:
+          if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; // Redo this state
+          else power_monitor.add_current_sample(hal.adc_value());
+          break;
+      #endif
 
-    #if HAS_JOY_ADC_Y
-      case PrepareJoy_Y: hal.adc_start(JOY_Y_PIN); break;
-      case MeasureJoy_Y: ACCUMULATE_ADC(joystick.y); break;
-    #endif
+      #if ENABLED(POWER_MONITOR_VOLTAGE)
+        case Prepare_POWER_MONITOR_VOLTAGE:
+          hal.adc_start(POWER_MONITOR_VOLTAGE_PIN);
+          break;
+        case Measure_POWER_MONITOR_VOLTAGE:
+          if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; // Redo this state
+          else power_monitor.add_voltage_sample(hal.adc_value());
+          break;
+      #endif
 
-    #if HAS_JOY_ADC_Z
-      case PrepareJoy_Z: hal.adc_start(JOY_Z_PIN); break;
-      case MeasureJoy_Z: ACCUMULATE_ADC(joystick.z); break;
-    #endif
+      #if HAS_JOY_ADC_X
+        case PrepareJoy_X: hal.adc_start(JOY_X_PIN); break;
+        case MeasureJoy_X: ACCUMULATE_ADC(joystick.x); break;
+      #endif
 
-    #if HAS_ADC_BUTTONS
-      #ifndef ADC_BUTTON_DEBOUNCE_DELAY
-        #define ADC_BUTTON_DEBOUNCE_DELAY 16
+      #if HAS_JOY_ADC_Y
+        case PrepareJoy_Y: hal.adc_start(JOY_Y_PIN); break;
+        case MeasureJoy_Y: ACCUMULATE_ADC(joystick.y); break;
       #endif
-      case Prepare_ADC_KEY: hal.adc_start(ADC_KEYPAD_PIN); break;
-      case Measure_ADC_KEY:
-        if (!hal.adc_ready())
-          next_sensor_state = adc_sensor_state; // redo this state
-        else if (ADCKey_count < ADC_BUTTON_DEBOUNCE_DELAY) {
-          raw_ADCKey_value = hal.adc_value();
-          if (raw_ADCKey_value <= 900UL * HAL_ADC_RANGE / 1024UL) {
-            NOMORE(current_ADCKey_raw, raw_ADCKey_value);
-            ADCKey_count++;
-          }
-          else { //ADC Key release
-            if (ADCKey_count > 0) ADCKey_count++; else ADCKey_pressed = false;
-            if (ADCKey_pressed) {
-              ADCKey_count = 0;
-              current_ADCKey_raw = HAL_ADC_RANGE;
-            }
-          }
-        }
-        if (ADCKey_count == ADC_BUTTON_DEBOUNCE_DELAY) ADCKey_pressed = true;
-        break;
-    #endif // HAS_ADC_BUTTONS
 
-    case StartupDelay: break;
+      #if HAS_JOY_ADC_Z
+        case PrepareJoy_Z: hal.adc_start(JOY_Z_PIN); break;
+        case MeasureJoy_Z: ACCUMULATE_ADC(joystick.z); break;
+      #endif
+
+      #if HAS_ADC_BUTTONS
+        case Prepare_ADC_KEY: hal.adc_start(ADC_KEYPAD_PIN); break;
+        case Measure_ADC_KEY:
+          if (!hal.adc_ready())
+            next_sensor_state = adc_sensor_state; // redo this state
+          else
+            sample_adc_key(hal.adc_value());
+          break;
+      #endif // HAS_ADC_BUTTONS
+
+      case StartupDelay: break;
+
+    } // switch(adc_sensor_state)
 
-  } // switch(adc_sensor_state)
+    // Go to the next state
+    adc_sensor_state = next_sensor_state;
 
-  // Go to the next state
-  adc_sensor_state = next_sensor_state;
+  #endif // !ADC_SCAN_MODE
 
   //
   // Additional ~1kHz Tasks
@@ -41,6 +41,10 @@
   #include "../feature/fancheck.h"
 #endif
 
+#if ENABLED(ADC_SCAN_MODE)
+  #include "../HAL/shared/adc_scan.h"
+#endif
+
 //#define ERR_INCLUDE_TEMP
 
 #define HOTEND_INDEX TERN0(HAS_MULTI_HOTEND, e)
@@ -141,7 +145,14 @@ enum ADCSensorState : char {
 // get all oversampled sensor readings
 #define MIN_ADC_ISR_LOOPS 10
 
-#define ACTUAL_ADC_SAMPLES _MAX(int(MIN_ADC_ISR_LOOPS), int(SensorsReady))
+#if ENABLED(ADC_SCAN_MODE)
+  // All channels are converted on every ISR loop, in the order of the states above
+  #define ACTUAL_ADC_SAMPLES 1
+  #define ADC_SCAN_CHANNELS ((int(SensorsReady) - 1) / 2)
+  #define ADC_SCAN_INDEX(S) ((int(Prepare##S) - 1) / 2)
+#else
+  #define ACTUAL_ADC_SAMPLES _MAX(int(MIN_ADC_ISR_LOOPS), int(SensorsReady))
+#endif
 
 //
 // PID
@@ -451,8 +462,38 @@ struct PIDHeaterInfo : public HeaterInfo {
     float modeled_ambient_temp,
           modeled_block_temp,
           modeled_sensor_temp;
+
+    // Discrete-time model coefficients, derived from 'mpc' by refresh_model()
+    struct {
+      bool valid;               // Cleared by Temperature::updateMPC() when 'mpc' changes
+      uint8_t fan_speed;        // Fan speed used for ambient_xfer_coeff
+      float ambient_xfer_coeff, // Ambient transfer coefficient at fan_speed (W/K)
+            heat_gain,          // Block temperature change per Joule in one step (MPC_dT / C)
+            heater_gain,        // Block temperature change per unit of soft_pwm_amount in one step
+            sensor_gain,        // Fraction of the block to sensor difference closed in one step
+            power_gain;         // Heater output per Watt (254 / P)
+    } model;
+
+    void refresh_model(const uint8_t fan_speed=0) {
+      if (!model.valid) {
+        model.heat_gain = MPC_dT / mpc.block_heat_capacity;
+        model.heater_gain = mpc.heater_power * RECIPROCAL(127) * model.heat_gain;
+        model.sensor_gain = mpc.sensor_responsiveness * MPC_dT;
+        model.power_gain = 254.0f / mpc.heater_power;
+      }
+      else if (TERN1(MPC_INCLUDE_FAN, fan_speed == model.fan_speed))
+        return;
+
+      model.ambient_xfer_coeff = mpc.ambient_xfer_coeff_fan0;
+      #if ENABLED(MPC_INCLUDE_FAN)
+        model.ambient_xfer_coeff += fan_speed * RECIPROCAL(255) * mpc.fan255_adjustment;
+      #endif
+      model.fan_speed = fan_speed;
+      model.valid = true;
+    }
+
     float fanCoefficient() { return mpc.fanCoefficient(); }
-    void applyFanAdjustment(const_float_t cf) { mpc.applyFanAdjustment(cf); }
+    void applyFanAdjustment(const_float_t cf) { mpc.applyFanAdjustment(cf); model.valid = false; }
   };
 #endif
 
@@ -590,6 +631,21 @@ typedef struct { raw_adc_t raw_min, raw_max; celsius_t mintemp, maxtemp; } temp_
           beta, beta_recip;
   } user_thermistor_t;
 
+  #if ENABLED(USER_THERMISTOR_LUT)
+    // Bits needed for half of the raw ADC range
+    constexpr uint8_t user_thermistor_half_bits(const uint8_t b=0) {
+      return (uint32_t(MAX_RAW_THERMISTOR_VALUE) >> (b + 1)) ? user_thermistor_half_bits(b + 1) : b;
+    }
+    // One cell per raw value up to _BV(USER_THERMISTOR_LUT_BITS), then that many cells per octave up to mid-range
+    constexpr uint16_t user_thermistor_lut_cells = _BV(USER_THERMISTOR_LUT_BITS) * (user_thermistor_half_bits() - (USER_THERMISTOR_LUT_BITS) + 1);
+
+    // Interpolation table for a user thermistor, in 1/16 °C
+    typedef struct {
+      int16_t lower[user_thermistor_lut_cells + 1], // Cells measured up from raw 0
+              upper[user_thermistor_lut_cells + 1]; // Cells measured down from MAX_RAW_THERMISTOR_VALUE
+    } user_thermistor_lut_t;
+  #endif
+
 #endif
 
 #if HAS_AUTO_FAN || HAS_FANCHECK
@@ -819,6 +875,10 @@ class Temperature {
 
     #if HAS_USER_THERMISTORS
       static user_thermistor_t user_thermistor[USER_THERMISTORS];
+      #if ENABLED(USER_THERMISTOR_LUT)
+        static user_thermistor_lut_t user_thermistor_lut[USER_THERMISTORS];
+        static float user_thermistor_lut_error(const uint8_t t_index);
+      #endif
       static void M305_report(const uint8_t t_index, const bool forReplay=true);
       static void reset_user_thermistors();
       static celsius_float_t user_thermistor_to_deg_c(const uint8_t t_index, const raw_adc_t raw);
@@ -826,6 +886,7 @@ class Temperature {
         //if (!WITHIN(t_index, 0, USER_THERMISTORS - 1)) return false;
         if (!WITHIN(value, 1, 1000000)) return false;
         user_thermistor[t_index].series_res = value;
+        TERN_(USER_THERMISTOR_LUT, user_thermistor[t_index].pre_calc = true); // Rebuild the table
         return true;
       }
       static bool set_res25(int8_t t_index, float value) {
@@ -1203,6 +1264,11 @@ class Temperature {
 
     static bool tuning_idle(const millis_t &ms);
 
+    // Update the temp manager when MPC values change
+    #if ENABLED(MPCTEMP)
+      static void updateMPC() { HOTEND_LOOP() temp_hotend[e].model.valid = false; }
+    #endif
+
     /**
      * M303 PID auto-tuning for hotends or bed
      */
@@ -1335,12 +1401,24 @@ class Temperature {
     static volatile bool raw_temps_ready;
     static void update_raw_temperatures();
     static void updateTemperaturesFromRawValues();
-    static bool updateTemperaturesIfReady() {
-      if (!raw_temps_ready) return false;
-      updateTemperaturesFromRawValues();
-      raw_temps_ready = false;
-      return true;
-    }
+    #if ENABLED(ADC_SCAN_MODE)
+      // Sums of the scanned channels, handed over from the ISR
+      static ADCScanHandoff<ADC_SCAN_CHANNELS, OVERSAMPLENR> adc_scan;
+      static bool updateTemperaturesIfReady() {
+        if (!adc_scan.is_ready()) return false;
+        update_raw_temperatures();
+        adc_scan.release();
+        updateTemperaturesFromRawValues();
+        return true;
+      }
+    #else
+      static bool updateTemperaturesIfReady() {
+        if (!raw_temps_ready) return false;
+        updateTemperaturesFromRawValues();
+        raw_temps_ready = false;
+        return true;
+      }
+    #endif
 
     // MAX Thermocouples
     #if HAS_MAX_TC
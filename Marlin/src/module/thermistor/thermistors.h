@@ -348,7 +348,7 @@ typedef struct { raw_adc_t value; celsius_t celsius; } temp_entry_t;
   #define TEMPTABLE_REDUNDANT_LEN 0
 #endif
 
-// The SCAN_THERMISTOR_TABLE macro needs alteration?
+// The thermistor grid index needs alteration?
 static_assert(255 > TEMPTABLE_0_LEN || 255 > TEMPTABLE_1_LEN || 255 > TEMPTABLE_2_LEN || 255 > TEMPTABLE_3_LEN
            || 255 > TEMPTABLE_4_LEN || 255 > TEMPTABLE_5_LEN || 255 > TEMPTABLE_6_LEN || 255 > TEMPTABLE_7_LEN
            || 255 > TEMPTABLE_BED_LEN
@@ -360,6 +360,52 @@ static_assert(255 > TEMPTABLE_0_LEN || 255 > TEMPTABLE_1_LEN || 255 > TEMPTABLE_
   , "Temperature conversion tables over 255 entries need special consideration."
 );
 
+/**
+ * Uniform-grid index for a conversion table
+ *
+ * The raw range is split into THERMISTOR_GRID_CELLS equal cells, each holding the index
+ * of the first table entry at or above the start of the cell. A lookup is then a shift
+ * and a byte read to land on (or just before) the right entry, instead of a bisection.
+ * Grids are built at compile time from the constexpr tables.
+ */
+#define THERMISTOR_GRID_CELLS 128
+
+typedef struct { uint8_t index[THERMISTOR_GRID_CELLS]; } thermistor_grid_t;
+
+// The smallest shift that maps every raw value onto a grid cell
+constexpr uint8_t thermistor_grid_shift(const uint8_t s=0) {
+  return (uint32_t(MAX_RAW_THERMISTOR_VALUE) >> s) < (THERMISTOR_GRID_CELLS) ? s : thermistor_grid_shift(s + 1);
+}
+
+template<size_t LEN>
+constexpr thermistor_grid_t make_thermistor_grid(const temp_entry_t (&tbl)[LEN]) {
+  thermistor_grid_t grid{};
+  uint8_t i = 0;
+  for (uint16_t c = 0; c < THERMISTOR_GRID_CELLS; ++c) {
+    const uint32_t cell_start = uint32_t(c) << thermistor_grid_shift();
+    while (i < LEN && tbl[i].value < cell_start) ++i;
+    grid.index[c] = i;
+  }
+  return grid;
+}
+
+/**
+ * Convert a raw value to Celsius with a table and its grid.
+ * Interpolate proportionally between the entries below and above 'raw'.
+ * Values beyond either end of the table get the end temperature.
+ */
+inline celsius_float_t thermistor_table_celsius(const temp_entry_t * const tbl, const uint8_t len, const thermistor_grid_t &grid, const raw_adc_t raw) {
+  uint8_t i = pgm_read_byte(&grid.index[raw >> thermistor_grid_shift()]);
+  while (i < len && raw > raw_adc_t(pgm_read_word(&tbl[i].value))) ++i;
+  if (i == 0) return celsius_t(pgm_read_word(&tbl[0].celsius));
+  if (i >= len) return celsius_t(pgm_read_word(&tbl[len - 1].celsius));
+  const raw_adc_t v00 = pgm_read_word(&tbl[i - 1].value),
+                  v10 = pgm_read_word(&tbl[i].value);
+  const celsius_t v01 = celsius_t(pgm_read_word(&tbl[i - 1].celsius)),
+                  v11 = celsius_t(pgm_read_word(&tbl[i].celsius));
+  return v01 + (raw - v00) * float(v11 - v01) / float(v10 - v00);
+}
+
 // Set the high and low raw values for the heaters
 // For thermistors the highest temperature results in the lowest ADC value
 // For thermocouples the highest temperature results in the highest ADC value
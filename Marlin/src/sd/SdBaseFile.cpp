@@ -1388,7 +1388,7 @@ int16_t SdBaseFile::read(void * const buf, uint16_t nbyte) {
         // start of new cluster
         if (curPosition_ == 0)
           curCluster_ = firstCluster_;                      // use first cluster in file
-        else if (!vol_->fatGet(curCluster_, &curCluster_))  // get next cluster from FAT
+        else if (!vol_->TERN(SD_READ_AHEAD, chainNext, fatGet)(curCluster_, &curCluster_))  // get next cluster from FAT
           return -1;
       }
       block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
@@ -1400,8 +1400,28 @@ int16_t SdBaseFile::read(void * const buf, uint16_t nbyte) {
 
     // no buffering needed if n == 512
     if (n == 512 && block != vol_->cacheBlockNumber()) {
+      #if ENABLED(SD_READ_AHEAD)
+        // read all the whole blocks left in this cluster in one transfer
+        const uint16_t count = type_ == FAT_FILE_TYPE_ROOT_FIXED ? 1
+          : _MIN(toRead >> 9, uint16_t(vol_->blocksPerCluster() - vol_->blockOfCluster(curPosition_)));
+        if (count > 1) {
+          if (!vol_->readBlocks(block, count, dst)) return -1;
+          n = count << 9;
+        }
+        else
+      #endif
       if (!vol_->readBlock(block, dst)) return -1;
     }
+    #if ENABLED(SD_READ_AHEAD)
+      else if (isFile()) {
+        // read ahead if the next block is also in this file
+        const bool readNext = (curPosition_ | 0x1FF) + 1 < fileSize_
+          && (vol_->blockOfCluster(curPosition_) + 1 < vol_->blocksPerCluster() || vol_->mappedNext(curCluster_) == curCluster_ + 1);
+        const uint8_t * const src = vol_->cacheAhead(block, readNext);
+        if (!src) return -1;
+        memcpy(dst, src + offset, n);
+      }
+    #endif
     else {
       // read block to cache and copy data to caller
       if (!vol_->cacheRawBlock(block, SdVolume::CACHE_FOR_READ)) return -1;
@@ -1936,7 +1956,7 @@ bool SdBaseFile::seekSet(const uint32_t pos) {
     nNew -= nCur;                     // advance from curPosition
 
   while (nNew--)
-    if (!vol_->fatGet(curCluster_, &curCluster_)) return false;
+    if (!vol_->TERN(SD_READ_AHEAD, chainNext, fatGet)(curCluster_, &curCluster_)) return false;
 
   curPosition_ = pos;
   return true;
@@ -44,6 +44,10 @@
   DiskIODriver *SdVolume::sdCard_;       // pointer to SD card object
   bool     SdVolume::cacheDirty_;        // cacheFlush() will write block if true
   uint32_t SdVolume::cacheMirrorBlock_;  // mirror  block for second FAT
+  #if ENABLED(SD_READ_AHEAD)
+    cache_t  SdVolume::aheadBuffer_[2];    // read-ahead blocks for file data
+    uint32_t SdVolume::aheadBlock_[2];     // read-ahead block numbers
+  #endif
 #endif
 
 // find a contiguous group of clusters
@@ -144,10 +148,96 @@ bool SdVolume::cacheRawBlock(const uint32_t blockNumber, const bool dirty) {
     if (!sdCard_->readBlock(blockNumber, cacheBuffer_.data)) return false;
     cacheBlockNumber_ = blockNumber;
   }
-  if (dirty) cacheDirty_ = true;
+  if (dirty) {
+    cacheDirty_ = true;
+    TERN_(SD_READ_AHEAD, aheadDrop(blockNumber));
+  }
   return true;
 }
 
+#if ENABLED(SD_READ_AHEAD)
+
+  /**
+   * Get a file data block from the read-ahead slots, which are separate
+   * from the FAT and directory cache so those lookups don't evict it.
+   * On a miss with readNext set, also read the following block of the
+   * file in the same transfer, ready for the next call.
+   */
+  uint8_t* SdVolume::cacheAhead(const uint32_t blockNumber, const bool readNext) {
+    if (blockNumber == cacheBlockNumber_) return cacheBuffer_.data;   // May be newer than the card
+    for (uint8_t i = 0; i < 2; ++i)
+      if (aheadBlock_[i] == blockNumber) return aheadBuffer_[i].data;
+
+    aheadBlock_[0] = aheadBlock_[1] = 0xFFFFFFFF;
+    if (readNext) {
+      if (!readBlocks(blockNumber, 2, aheadBuffer_[0].data)) return nullptr;
+      aheadBlock_[1] = blockNumber + 1;
+    }
+    else if (!sdCard_->readBlock(blockNumber, aheadBuffer_[0].data))
+      return nullptr;
+
+    aheadBlock_[0] = blockNumber;
+    return aheadBuffer_[0].data;
+  }
+
+  // Forget a read-ahead block that is about to be written
+  void SdVolume::aheadDrop(const uint32_t blockNumber) {
+    for (uint8_t i = 0; i < 2; ++i)
+      if (aheadBlock_[i] == blockNumber) aheadBlock_[i] = 0xFFFFFFFF;
+  }
+
+  // Read consecutive blocks in one multiple block transfer
+  bool SdVolume::readBlocks(const uint32_t block, const uint16_t count, uint8_t *dst) {
+    // A dirty block in the cache is newer than the card
+    if (cacheBlockNumber_ - block < count && !cacheFlush()) return false;
+    bool success = sdCard_->readStart(block);
+    for (uint16_t i = 0; success && i < count; ++i, dst += 512)
+      success = sdCard_->readData(dst);
+    return sdCard_->readStop() && success;
+  }
+
+  /**
+   * Follow a cluster chain into a list of contiguous runs.
+   * A chain too fragmented for SD_CLUSTER_EXTENTS is mapped in part
+   * and the rest is looked up in the FAT as usual.
+   */
+  bool SdVolume::mapChain(uint32_t cluster) {
+    extentCount_ = 0;
+    if (cluster < 2) return true;   // Empty file
+
+    extent_t *e = &extent_[0];
+    *e = { cluster, 1 };
+    extentCount_ = 1;
+    for (;;) {
+      uint32_t next;
+      if (!fatGet(cluster, &next)) { extentCount_ = 0; return false; }
+      if (isEOC(next)) break;
+      if (next == cluster + 1)
+        e->count++;
+      else {
+        if (extentCount_ >= SD_CLUSTER_EXTENTS) break;
+        *++e = { next, 1 };
+        extentCount_++;
+      }
+      cluster = next;
+    }
+    return true;
+  }
+
+  // The next cluster in the mapped chain, or 0 if the map doesn't say
+  uint32_t SdVolume::mappedNext(const uint32_t cluster) const {
+    for (uint8_t i = 0; i < extentCount_; ++i) {
+      const uint32_t off = cluster - extent_[i].cluster;
+      if (off < extent_[i].count) {
+        if (off + 1 < extent_[i].count) return cluster + 1;
+        return i + 1 < extentCount_ ? extent_[i + 1].cluster : 0;
+      }
+    }
+    return 0;
+  }
+
+#endif // SD_READ_AHEAD
+
 // return the size in bytes of a cluster chain
 bool SdVolume::chainSize(uint32_t cluster, uint32_t * const size) {
   uint32_t s = 0;
@@ -205,6 +295,9 @@ bool SdVolume::fatPut(const uint32_t cluster, const uint32_t value) {
   // error if not in FAT
   if (cluster > (clusterCount_ + 1)) return false;
 
+  // The mapped chain is changing
+  TERN_(SD_READ_AHEAD, if (mappedNext(cluster)) extentCount_ = 0);
+
   if (FAT12_SUPPORT && fatType_ == 12) {
     uint16_t index = cluster;
     index += index >> 1;
@@ -336,6 +429,10 @@ bool SdVolume::init(DiskIODriver * const dev, const uint8_t part) {
   cacheDirty_ = 0;  // cacheFlush() will write block if true
   cacheMirrorBlock_ = 0;
   cacheBlockNumber_ = 0xFFFFFFFF;
+  #if ENABLED(SD_READ_AHEAD)
+    aheadBlock_[0] = aheadBlock_[1] = 0xFFFFFFFF;
+    extentCount_ = 0;
+  #endif
 
   // if part == 0 assume super floppy with FAT boot sector in block zero
   // if part > 0 assume mbr volume with partition table
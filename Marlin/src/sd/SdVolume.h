@@ -129,6 +129,11 @@ class SdVolume {
    */
   bool dbgFat(const uint32_t n, uint32_t * const v) { return fatGet(n, v); }
 
+  #if ENABLED(SD_READ_AHEAD)
+    // Map the cluster chain of a file so reading it needs no FAT lookups
+    bool mapChain(uint32_t cluster);
+  #endif
+
  private:
   // Allow SdBaseFile access to SdVolume private data.
   friend class SdBaseFile;
@@ -144,12 +149,27 @@ class SdVolume {
     DiskIODriver *sdCard_;       // DiskIODriver object for cache
     bool cacheDirty_;            // cacheFlush() will write block if true
     uint32_t cacheMirrorBlock_;  // block number for mirror FAT
+    #if ENABLED(SD_READ_AHEAD)
+      cache_t aheadBuffer_[2];     // Read-ahead blocks for file data
+      uint32_t aheadBlock_[2];     // Logical numbers of the read-ahead blocks
+    #endif
   #else
     static cache_t cacheBuffer_;        // 512 byte cache for device blocks
     static uint32_t cacheBlockNumber_;  // Logical number of block in the cache
     static DiskIODriver *sdCard_;       // DiskIODriver object for cache
     static bool cacheDirty_;            // cacheFlush() will write block if true
     static uint32_t cacheMirrorBlock_;  // block number for mirror FAT
+    #if ENABLED(SD_READ_AHEAD)
+      static cache_t aheadBuffer_[2];     // Read-ahead blocks for file data
+      static uint32_t aheadBlock_[2];     // Logical numbers of the read-ahead blocks
+    #endif
+  #endif
+
+  #if ENABLED(SD_READ_AHEAD)
+    // A run of contiguous clusters in the mapped chain
+    struct extent_t { uint32_t cluster, count; };
+    extent_t extent_[SD_CLUSTER_EXTENTS];
+    uint8_t extentCount_;
   #endif
 
   uint32_t allocSearchStart_;   // start cluster for alloc search
@@ -175,18 +195,38 @@ class SdVolume {
   #if USE_MULTIPLE_CARDS
     bool cacheFlush();
     bool cacheRawBlock(const uint32_t blockNumber, const bool dirty);
+    #if ENABLED(SD_READ_AHEAD)
+      uint8_t* cacheAhead(const uint32_t blockNumber, const bool readNext);
+      void aheadDrop(const uint32_t blockNumber);
+      bool readBlocks(const uint32_t block, const uint16_t count, uint8_t *dst);
+    #endif
   #else
     static bool cacheFlush();
     static bool cacheRawBlock(const uint32_t blockNumber, const bool dirty);
+    #if ENABLED(SD_READ_AHEAD)
+      static uint8_t* cacheAhead(const uint32_t blockNumber, const bool readNext);
+      static void aheadDrop(const uint32_t blockNumber);
+      static bool readBlocks(const uint32_t block, const uint16_t count, uint8_t *dst);
+    #endif
   #endif
 
   // used by SdBaseFile write to assign cache to SD location
   void cacheSetBlockNumber(uint32_t blockNumber, bool dirty) {
+    TERN_(SD_READ_AHEAD, if (dirty) aheadDrop(blockNumber));
     cacheDirty_ = dirty;
     cacheBlockNumber_  = blockNumber;
   }
   void cacheSetDirty() { cacheDirty_ |= CACHE_FOR_WRITE; }
   bool chainSize(uint32_t cluster, uint32_t * const size);
+  #if ENABLED(SD_READ_AHEAD)
+    uint32_t mappedNext(const uint32_t cluster) const;
+    bool chainNext(const uint32_t cluster, uint32_t * const next) {
+      const uint32_t c = mappedNext(cluster);
+      if (!c) return fatGet(cluster, next);
+      *next = c;
+      return true;
+    }
+  #endif
   bool fatGet(const uint32_t cluster, uint32_t * const value);
   bool fatPut(const uint32_t cluster, const uint32_t value);
   bool fatPutEOC(const uint32_t cluster) { return fatPut(cluster, 0x0FFFFFFF); }
@@ -197,7 +237,10 @@ class SdVolume {
     return cluster >= FAT32EOC_MIN;
   }
   bool readBlock(const uint32_t block, uint8_t * const dst) { return sdCard_->readBlock(block, dst); }
-  bool writeBlock(const uint32_t block, const uint8_t * const dst) { return sdCard_->writeBlock(block, dst); }
+  bool writeBlock(const uint32_t block, const uint8_t * const dst) {
+    TERN_(SD_READ_AHEAD, aheadDrop(block));
+    return sdCard_->writeBlock(block, dst);
+  }
 };
 
 using MarlinVolume = SdVolume;
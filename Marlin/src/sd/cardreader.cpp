@@ -64,6 +64,10 @@
   #include "../../src/lcd/menu/menu.h"
 #endif
 
+#if ENABLED(DIRECT_STEPPING_FILES)
+  #include "../feature/direct_stepping.h"
+#endif
+
 #define DEBUG_OUT ANY(DEBUG_CARDREADER, MARLIN_DEV_MODE)
 #include "../core/debug_out.h"
 #include "../libs/hex_print.h"
@@ -159,6 +163,34 @@ MediaFile CardReader::myfile;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#ifdef SDCARD_READ_BUFFER_SIZE
+
+  uint8_t CardReader::readBuffer[SDCARD_READ_BUFFER_SIZE];
+  uint32_t CardReader::readBase;
+  uint16_t CardReader::readIndex, CardReader::readLength;
+
+  /**
+   * Refill the read buffer from the current file position.
+   * Only read up to the next block boundary so that every later
+   * refill is a run of whole blocks, which SdBaseFile reads straight
+   * into the buffer without going through the volume cache.
+   */
+  bool CardReader::fillReadBuffer() {
+    sdpos = readBase = myfile.curPosition();
+    const int16_t n = myfile.read(readBuffer, SDCARD_READ_BUFFER_SIZE - (readBase & 0x1FF));
+    readIndex = 0;
+    readLength = n > 0 ? n : 0;
+    return readLength;
+  }
+
+  // Put the file position back on the next unread character for direct reads
+  void CardReader::syncReadBuffer() {
+    if (readIndex < readLength) myfile.seekSet(readBase + readIndex);
+    resetReadBuffer();
+  }
+
+#endif
+
 CardReader::CardReader() {
   #if ENABLED(SDCARD_SORT_ALPHA)
     sort_count = 0;
@@ -722,6 +754,7 @@ void CardReader::endFilePrintNow(TERN_(SD_RESORT, const bool re_sort/*=false*/))
   TERN_(DWIN_CREALITY_LCD, hmiFlag.print_finish = flag.sdprinting);
   flag.abort_sd_printing = false;
   if (isFileOpen()) myfile.close();
+  resetReadBuffer();
   TERN_(SD_RESORT, if (re_sort) presort());
 }
 
@@ -795,6 +828,7 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
     case 0:      // Starting a new print. "Now fresh file: ..."
       announceOpen(2, path);
       TERN_(HAS_MEDIA_SUBCALLS, file_subcall_ctr = 0);
+      TERN_(DIRECT_STEPPING_FILES, page_manager.reset_media_pages());
       break;
 
     #if HAS_MEDIA_SUBCALLS
@@ -836,6 +870,8 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   if (myfile.open(diveDir, fname, O_READ)) {
     filesize = myfile.fileSize();
     sdpos = 0;
+    resetReadBuffer();
+    TERN_(SD_READ_AHEAD, volume.mapChain(myfile.firstCluster()));
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
@@ -1100,6 +1136,7 @@ void CardReader::closefile(const bool store_location/*=false*/) {
   myfile.close();
   flag.saving = flag.logging = false;
   sdpos = 0;
+  resetReadBuffer();
 
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
@@ -1537,6 +1574,7 @@ int16_t CardReader::get_num_items() {
 //
 void CardReader::fileHasFinished() {
   myfile.close();
+  resetReadBuffer();
 
   #if HAS_MEDIA_SUBCALLS
     if (file_subcall_ctr > 0) { // Resume calling file after closing procedure
@@ -1569,7 +1607,7 @@ void CardReader::fileHasFinished() {
   void CardReader::openJobRecoveryFile(const bool read) {
     if (!isMounted()) return;
     if (recovery.file.isOpen()) return;
-    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | O_SYNC))
+    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | TERN(POWER_LOSS_JOURNAL, 0, O_TRUNC) | O_SYNC))
       openFailed(recovery.filename);
     else if (!read)
       echo_write_to_file(recovery.filename);
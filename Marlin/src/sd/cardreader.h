@@ -314,10 +314,22 @@ public:
   static bool eof()              { return getIndex() >= getFileSize(); }
 
   // File data operations
-  static int16_t get()                            { int16_t out = (int16_t)myfile.read(); sdpos = myfile.curPosition(); return out; }
-  static int16_t read(void *buf, uint16_t nbyte)  { return myfile.isOpen() ? myfile.read(buf, nbyte) : -1; }
+  #ifdef SDCARD_READ_BUFFER_SIZE
+    // Characters come from a block-aligned buffer. sdpos is still exact for every character.
+    static int16_t get() {
+      if (readIndex >= readLength && !fillReadBuffer()) return -1;
+      const uint8_t c = readBuffer[readIndex++];
+      sdpos = readBase + readIndex;
+      return c;
+    }
+    static int16_t read(void *buf, uint16_t nbyte)  { syncReadBuffer(); return myfile.isOpen() ? myfile.read(buf, nbyte) : -1; }
+    static void setIndex(const uint32_t index)      { resetReadBuffer(); myfile.seekSet((sdpos = index)); }
+  #else
+    static int16_t get()                            { int16_t out = (int16_t)myfile.read(); sdpos = myfile.curPosition(); return out; }
+    static int16_t read(void *buf, uint16_t nbyte)  { return myfile.isOpen() ? myfile.read(buf, nbyte) : -1; }
+    static void setIndex(const uint32_t index)      { myfile.seekSet((sdpos = index)); }
+  #endif
   static int16_t write(void *buf, uint16_t nbyte) { return myfile.isOpen() ? myfile.write(buf, nbyte) : -1; }
-  static void setIndex(const uint32_t index)      { myfile.seekSet((sdpos = index)); }
 
   #if ENABLED(AUTO_REPORT_SD_STATUS)
     //
@@ -338,6 +350,17 @@ private:
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
+  #ifdef SDCARD_READ_BUFFER_SIZE
+    static uint8_t readBuffer[SDCARD_READ_BUFFER_SIZE];
+    static uint32_t readBase;                 // File position of readBuffer[0]
+    static uint16_t readIndex, readLength;    // Next character and end of the buffered data
+    static bool fillReadBuffer();
+    static void syncReadBuffer();
+    static void resetReadBuffer() { readIndex = readLength = 0; }
+  #else
+    static void resetReadBuffer() {}
+  #endif
+
   //
   // Working directory and parents
   //
@@ -0,0 +1,100 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+#include <src/HAL/shared/adc_scan.h>
+
+// Add the same scan 'n' times. Return 'true' if the last one completed a set.
+template<typename T>
+static bool add_scans(T &handoff, const uint16_t values[], const uint8_t n) {
+  bool done = false;
+  for (uint8_t i = 0; i < n; ++i) done = handoff.add(values);
+  return done;
+}
+
+MARLIN_TEST(adc_scan, handoff_sums_a_set) {
+  ADCScanHandoff<3, 4> handoff;
+  const uint16_t values[] = { 100, 200, 1023 };
+
+  TEST_ASSERT_FALSE(add_scans(handoff, values, 3));
+  TEST_ASSERT_FALSE(handoff.is_ready());
+
+  TEST_ASSERT_TRUE(handoff.add(values));
+  TEST_ASSERT_TRUE(handoff.is_ready());
+  TEST_ASSERT_EQUAL(400, handoff.get(0));
+  TEST_ASSERT_EQUAL(800, handoff.get(1));
+  TEST_ASSERT_EQUAL(4092, handoff.get(2));
+}
+
+MARLIN_TEST(adc_scan, handoff_keeps_set_until_released) {
+  ADCScanHandoff<2, 2> handoff;
+  const uint16_t first[] = { 1, 2 }, second[] = { 10, 20 }, third[] = { 100, 200 };
+
+  TEST_ASSERT_TRUE(add_scans(handoff, first, 2));
+
+  // The reader hasn't released the first set, so the second is dropped
+  TEST_ASSERT_TRUE(add_scans(handoff, second, 2));
+  TEST_ASSERT_EQUAL(2, handoff.get(0));
+  TEST_ASSERT_EQUAL(4, handoff.get(1));
+
+  // A scan added while the reader holds a set still counts toward the next one
+  handoff.add(third);
+  handoff.release();
+  TEST_ASSERT_FALSE(handoff.is_ready());
+
+  TEST_ASSERT_TRUE(handoff.add(third));
+  TEST_ASSERT_TRUE(handoff.is_ready());
+  TEST_ASSERT_EQUAL(200, handoff.get(0));
+  TEST_ASSERT_EQUAL(400, handoff.get(1));
+}
+
+MARLIN_TEST(adc_scan, handoff_reset) {
+  ADCScanHandoff<1, 2> handoff;
+  const uint16_t values[] = { 5 };
+
+  handoff.add(values);
+  handoff.reset();
+  TEST_ASSERT_FALSE(handoff.add(values));
+  TEST_ASSERT_TRUE(handoff.add(values));
+  TEST_ASSERT_EQUAL(10, handoff.get(0));
+}
+
+#if ENABLED(ADC_SCAN_MODE)
+
+#include <src/HAL/HAL.h>
+
+MARLIN_TEST(adc_scan, hal_scan_reads_all_channels) {
+  const pin_t pins[] = { 0, 1, 2 };
+  uint16_t values[COUNT(pins)] = { 0 };
+
+  // The Linux HAL returns the pin value as a 10-bit reading
+  for (uint8_t i = 0; i < COUNT(pins); ++i)
+    Gpio::set(analogInputToDigitalPin(pins[i]), (i + 1) * 1000);
+
+  hal.adc_scan_start(pins, values, COUNT(pins));
+  TEST_ASSERT_TRUE(hal.adc_scan_ready());
+  TEST_ASSERT_EQUAL(1000 >> 2, values[0]);
+  TEST_ASSERT_EQUAL(2000 >> 2, values[1]);
+  TEST_ASSERT_EQUAL(3000 >> 2, values[2]);
+}
+
+#endif
@@ -0,0 +1,265 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+#include <src/HAL/shared/eeprom_log.h>
+
+// NOR flash in RAM that counts erases and programmed records
+struct TestFlash {
+  static constexpr uint8_t PAGES = 3;
+  static constexpr uint32_t PAGE_SIZE = 256;
+  static constexpr uint8_t WRITE_SIZE = 4;
+
+  static uint8_t image[PAGES][PAGE_SIZE];
+  static uint16_t erases, programs;
+  static int16_t fail_after;      // Programs until one is torn, or -1
+
+  static void clear() {
+    memset(image, 0xFF, sizeof(image));
+    erases = programs = 0;
+    fail_after = -1;
+  }
+  static bool erase(const uint8_t page) {
+    memset(image[page], 0xFF, PAGE_SIZE);
+    ++erases;
+    return false;
+  }
+  static bool program(const uint8_t page, const uint32_t offset, const void * const data, const uint32_t size) {
+    const uint8_t * const src = (const uint8_t*)data;
+    // A torn program writes only the first half
+    const uint32_t n = fail_after == 0 ? size / 2 : size;
+    for (uint32_t i = 0; i < n; ++i) image[page][offset + i] &= src[i];
+    ++programs;
+    if (fail_after >= 0 && !fail_after--) return true;
+    return false;
+  }
+  static void read(const uint8_t page, const uint32_t offset, void * const data, const uint32_t size) {
+    memcpy(data, &image[page][offset], size);
+  }
+};
+
+uint8_t TestFlash::image[PAGES][PAGE_SIZE];
+uint16_t TestFlash::erases, TestFlash::programs;
+int16_t TestFlash::fail_after;
+
+// 8 sections of 16 bytes. Records are 20 bytes, so a page holds 12 with the commit markers.
+typedef EEPROMLog<TestFlash, 128, 16> TestLog;
+
+static void write_all(TestLog &log, const uint8_t value) {
+  for (uint16_t pos = 0; pos < 128; ++pos) log.write(pos, value + pos);
+}
+
+MARLIN_TEST(eeprom_log, reads_erased_when_empty) {
+  TestFlash::clear();
+  TestLog log;
+  log.mount();
+  TEST_ASSERT_EQUAL(0xFF, log.read(0));
+  TEST_ASSERT_EQUAL(0xFF, log.read(127));
+  TEST_ASSERT_FALSE(log.is_dirty());
+}
+
+MARLIN_TEST(eeprom_log, unchanged_data_writes_nothing) {
+  TestFlash::clear();
+  TestLog log;
+  log.mount();
+  write_all(log, 1);
+  TEST_ASSERT_FALSE(log.commit());
+  const uint16_t programs = TestFlash::programs;
+
+  // Writing the same values again leaves nothing to commit
+  write_all(log, 1);
+  TEST_ASSERT_FALSE(log.is_dirty());
+  TEST_ASSERT_FALSE(log.commit());
+  TEST_ASSERT_EQUAL(programs, TestFlash::programs);
+}
+
+MARLIN_TEST(eeprom_log, commit_appends_changed_sections) {
+  TestFlash::clear();
+  TestLog log;
+  log.mount();
+  write_all(log, 1);
+  TEST_ASSERT_FALSE(log.commit());   // First commit compacts into a fresh page
+  TEST_ASSERT_EQUAL(1, TestFlash::erases);
+  TEST_ASSERT_EQUAL(9, log.records_used());
+
+  const uint16_t programs = TestFlash::programs;
+  log.write(5, 42);                  // Section 0
+  log.write(100, 43);                // Section 6
+  TEST_ASSERT_FALSE(log.commit());
+  TEST_ASSERT_EQUAL(programs + 3, TestFlash::programs); // Two records and the marker
+  TEST_ASSERT_EQUAL(12, log.records_used());
+  TEST_ASSERT_EQUAL(1, TestFlash::erases);
+
+  TestLog reader;
+  reader.mount();
+  TEST_ASSERT_EQUAL(42, reader.read(5));
+  TEST_ASSERT_EQUAL(43, reader.read(100));
+  TEST_ASSERT_EQUAL(1 + 99, reader.read(99));
+}
+
+MARLIN_TEST(eeprom_log, full_page_compacts_into_next) {
+  TestFlash::clear();
+  TestLog log;
+  log.mount();
+  write_all(log, 0);
+  log.commit();
+  const uint8_t first = log.active_page();
+
+  // A commit takes two of the remaining 3 slots, so the next one moves to the next page
+  for (uint8_t i = 1; i <= 2; ++i) {
+    log.write(i, 200 + i);
+    TEST_ASSERT_FALSE(log.commit());
+  }
+  TEST_ASSERT_EQUAL((first + 1) % TestFlash::PAGES, log.active_page());
+  TEST_ASSERT_EQUAL(9, log.records_used());
+  TEST_ASSERT_EQUAL(2, TestFlash::erases);
+
+  TestLog reader;
+  reader.mount();
+  for (uint8_t i = 1; i <= 2; ++i) TEST_ASSERT_EQUAL(200 + i, reader.read(i));
+  TEST_ASSERT_EQUAL(127, reader.read(127));
+}
+
+MARLIN_TEST(eeprom_log, pages_are_used_in_turn) {
+  TestFlash::clear();
+  TestLog log;
+  log.mount();
+  uint8_t seen = 0;
+  for (uint16_t i = 0; i < 100; ++i) {
+    log.write(i & 127, i);
+    log.commit();
+    seen |= 1 << log.active_page();
+  }
+  TEST_ASSERT_EQUAL(0b111, seen);
+}
+
+MARLIN_TEST(eeprom_log, torn_record_keeps_old_copy) {
+  TestFlash::clear();
+  TestLog log;
+  log.mount();
+  write_all(log, 1);
+  log.commit();
+
+  log.write(20, 99);
+  TestFlash::fail_after = 0;
+  TEST_ASSERT_TRUE(log.commit());
+
+  TestLog reader;
+  reader.mount();
+  TEST_ASSERT_EQUAL(1 + 20, reader.read(20));
+
+  // The torn slot is skipped and the next record lands after it
+  TestFlash::fail_after = -1;
+  reader.write(20, 99);
+  TEST_ASSERT_FALSE(reader.commit());
+  TestLog again;
+  again.mount();
+  TEST_ASSERT_EQUAL(99, again.read(20));
+}
+
+MARLIN_TEST(eeprom_log, torn_compaction_keeps_old_page) {
+  TestFlash::clear();
+  TestLog log;
+  log.mount();
+  write_all(log, 1);
+  log.commit();
+  const uint8_t first = log.active_page();
+
+  // Fill the page, then tear the compaction before the header is written
+  log.write(0, 50);
+  log.commit();
+  log.write(64, 77);
+  TestFlash::fail_after = 3;
+  TEST_ASSERT_TRUE(log.commit());
+
+  TestLog reader;
+  reader.mount();
+  TEST_ASSERT_EQUAL(first, reader.active_page());
+  TEST_ASSERT_EQUAL(50, reader.read(0));
+  TEST_ASSERT_EQUAL(1 + 64, reader.read(64));
+}
+
+MARLIN_TEST(eeprom_log, torn_page_header_is_ignored) {
+  TestFlash::clear();
+  TestLog log;
+  log.mount();
+  write_all(log, 1);
+  log.commit();
+  const uint8_t first = log.active_page();
+
+  // Fill the page, then tear the header after the 8 records and the marker
+  log.write(0, 50);
+  log.commit();
+  log.write(64, 77);
+  TestFlash::fail_after = 9;
+  TEST_ASSERT_TRUE(log.commit());
+
+  TestLog reader;
+  reader.mount();
+  TEST_ASSERT_EQUAL(first, reader.active_page());
+  TEST_ASSERT_EQUAL(1 + 64, reader.read(64));
+
+  // The next compaction replaces the torn page and is the one found after it
+  TestFlash::fail_after = -1;
+  reader.write(64, 77);
+  TEST_ASSERT_FALSE(reader.commit());
+  reader.write(1, 51);
+  TEST_ASSERT_FALSE(reader.commit());
+  TestLog again;
+  again.mount();
+  TEST_ASSERT_EQUAL((first + 1) % TestFlash::PAGES, again.active_page());
+  TEST_ASSERT_EQUAL(77, again.read(64));
+  TEST_ASSERT_EQUAL(51, again.read(1));
+}
+
+MARLIN_TEST(eeprom_log, torn_commit_changes_nothing) {
+  // Tear the second record, then the marker, of a two-section commit
+  for (int16_t fail = 1; fail <= 2; ++fail) {
+    TestFlash::clear();
+    TestLog log;
+    log.mount();
+    log.write(5, 1);
+    log.write(100, 1);
+    log.commit();
+
+    log.write(5, 42);                // Section 0
+    log.write(100, 43);              // Section 6
+    TestFlash::fail_after = fail;
+    TEST_ASSERT_TRUE(log.commit());
+
+    TestLog reader;
+    reader.mount();
+    TEST_ASSERT_EQUAL(1, reader.read(5));
+    TEST_ASSERT_EQUAL(1, reader.read(100));
+
+    // A later commit in the same page doesn't complete the torn one
+    TestFlash::fail_after = -1;
+    reader.write(127, 44);           // Section 7
+    TEST_ASSERT_FALSE(reader.commit());
+    TEST_ASSERT_EQUAL(1, TestFlash::erases);
+    TestLog again;
+    again.mount();
+    TEST_ASSERT_EQUAL(1, again.read(5));
+    TEST_ASSERT_EQUAL(1, again.read(100));
+    TEST_ASSERT_EQUAL(44, again.read(127));
+  }
+}
@@ -0,0 +1,78 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(DIRECT_STEPPING_FILES)
+
+#include <src/feature/direct_stepping.h>
+
+using namespace DirectStepping;
+
+// Look at the page states and leave them the way a print does
+struct PageProbe : PageManager {
+  static PageState state(const page_idx_t i) { return page_states[i]; }
+
+  // Pages still waiting for the stepper and a page write waiting for one of them
+  static void leave_busy(const page_idx_t waiting) {
+    for (page_idx_t i = 0; i < Config::PAGE_COUNT; ++i) page_states[i] = PageState::OK;
+    page_states[waiting] = PageState::WRITING;
+    media_page_idx = waiting;
+    media_page_wait = true;
+  }
+
+  static bool all_free() {
+    for (page_idx_t i = 0; i < Config::PAGE_COUNT; ++i)
+      if (page_states[i] != PageState::FREE) return false;
+    return true;
+  }
+};
+
+MARLIN_TEST(direct_stepping, abort_frees_media_pages) {
+  PageProbe::leave_busy(1);
+  TEST_ASSERT_TRUE(page_manager.media_page_waiting());
+
+  page_manager.reset_media_pages();
+  TEST_ASSERT_FALSE(page_manager.media_page_waiting());
+  TEST_ASSERT_TRUE(PageProbe::all_free());
+}
+
+MARLIN_TEST(direct_stepping, restart_after_abort) {
+  // Abort a print while a page write waits for a page
+  PageProbe::leave_busy(Config::PAGE_COUNT - 1);
+  page_manager.reset_media_pages();
+
+  // The next print gets as far as the same wait and is aborted too
+  PageProbe::leave_busy(0);
+  TEST_ASSERT_EQUAL(PageState::WRITING, PageProbe::state(0));
+  TEST_ASSERT_EQUAL(PageState::OK, PageProbe::state(Config::PAGE_COUNT - 1));
+  page_manager.reset_media_pages();
+  TEST_ASSERT_FALSE(page_manager.media_page_waiting());
+  TEST_ASSERT_TRUE(PageProbe::all_free());
+
+  // Starting another print with nothing left over changes nothing
+  page_manager.reset_media_pages();
+  TEST_ASSERT_FALSE(page_manager.media_page_waiting());
+  TEST_ASSERT_TRUE(PageProbe::all_free());
+}
+
+#endif // DIRECT_STEPPING_FILES
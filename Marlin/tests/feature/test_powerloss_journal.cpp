@@ -0,0 +1,111 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+#include <src/feature/powerloss.h>
+
+// A checkpoint as read from the recovery file
+static job_recovery_info_t checkpoint(const uint8_t valid) {
+  job_recovery_info_t ji{};
+  ji.valid_head = ji.valid_foot = valid;
+  ji.sdpos = 1000;
+  ji.current_position.set(10, 20, 0.2f, 5);
+  ji.feedrate = 1200;
+  ji.zraise = 2;
+  return ji;
+}
+
+// A record of the print moving on from the checkpoint in info
+static job_recovery_journal_t next_record(const uint32_t sdpos, const float z) {
+  const job_recovery_info_t saved = recovery.info;
+  recovery.info.sdpos = sdpos;
+  recovery.info.current_position.z = z;
+  job_recovery_journal_t rec;
+  recovery.journal_record(rec);
+  recovery.info = saved;
+  return rec;
+}
+
+// Apply the records the way load() does, returning how many were used
+static uint8_t replay(job_recovery_journal_t recs[], const uint8_t count) {
+  uint8_t n = 0;
+  while (n < count && recovery.journal_apply(recs[n])) ++n;
+  return n;
+}
+
+MARLIN_TEST(powerloss_journal, replays_records_in_order) {
+  recovery.info = checkpoint(7);
+  job_recovery_journal_t recs[] = { next_record(1100, 0.4f), next_record(1200, 0.6f) };
+  TEST_ASSERT_EQUAL(2, replay(recs, COUNT(recs)));
+  TEST_ASSERT_EQUAL(1200, recovery.info.sdpos);
+  TEST_ASSERT_EQUAL_FLOAT(0.6f, recovery.info.current_position.z);
+  TEST_ASSERT_EQUAL(7, recovery.info.valid_head);
+}
+
+MARLIN_TEST(powerloss_journal, stops_at_torn_record) {
+  recovery.info = checkpoint(7);
+  job_recovery_journal_t recs[] = { next_record(1100, 0.4f), next_record(1200, 0.6f), next_record(1300, 0.8f) };
+
+  // Power was lost halfway through writing the second record
+  memset((uint8_t*)&recs[1] + sizeof(recs[1]) / 2, 0xFF, sizeof(recs[1]) - sizeof(recs[1]) / 2);
+
+  TEST_ASSERT_EQUAL(1, replay(recs, COUNT(recs)));
+  TEST_ASSERT_EQUAL(1100, recovery.info.sdpos);
+  TEST_ASSERT_EQUAL_FLOAT(0.4f, recovery.info.current_position.z);
+}
+
+MARLIN_TEST(powerloss_journal, stops_at_stale_record) {
+  // Records left in the file after an older checkpoint
+  recovery.info = checkpoint(6);
+  job_recovery_journal_t old_rec = next_record(1500, 1.0f);
+
+  recovery.info = checkpoint(7);
+  job_recovery_journal_t recs[] = { next_record(1100, 0.4f), old_rec };
+  TEST_ASSERT_EQUAL(1, replay(recs, COUNT(recs)));
+  TEST_ASSERT_EQUAL(1100, recovery.info.sdpos);
+
+  // A record can't move the file position back
+  job_recovery_journal_t back[] = { next_record(900, 0.4f) };
+  TEST_ASSERT_EQUAL(0, replay(back, COUNT(back)));
+  TEST_ASSERT_EQUAL(1100, recovery.info.sdpos);
+}
+
+MARLIN_TEST(powerloss_journal, state_crc_leaves_info_unchanged) {
+  recovery.info = checkpoint(7);
+  const job_recovery_info_t before = recovery.info;
+  const uint16_t crc = recovery.journal_state_crc();
+  TEST_ASSERT_EQUAL(0, memcmp(&before, &recovery.info, sizeof(before)));
+
+  // Journaled fields don't change the checkpoint state
+  recovery.info.sdpos = 5000;
+  recovery.info.current_position.z = 3;
+  TEST_ASSERT_EQUAL(crc, recovery.journal_state_crc());
+
+  // Others need a new checkpoint
+  recovery.info.zraise = 5;
+  TEST_ASSERT_TRUE(crc != recovery.journal_state_crc());
+}
+
+#endif // POWER_LOSS_JOURNAL
@@ -0,0 +1,103 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(SERIAL_ACK_WINDOW)
+
+#include <src/gcode/gcode.h>
+#include <src/gcode/parser.h>
+#include <src/gcode/queue.h>
+
+// Run M577 the way a host would send it
+static void run_m577(const uint8_t lines) {
+  char cmd[16];
+  sprintf(cmd, "M577 S%u", lines);
+  parser.parse(cmd);
+  gcode.process_parsed_command(true);
+}
+
+// Read the replies and return the last line acknowledged by "ok N<line>", or -1
+static long read_acks() {
+  static char line[64];
+  static uint8_t len = 0;
+  long acked = -1;
+  while (MYSERIAL1.transmit_buffer.available()) {
+    const char c = MYSERIAL1.transmit_buffer.read();
+    if (c == '\n') {
+      line[len] = '\0';
+      len = 0;
+      if (!strncmp(line, "ok N", 4)) acked = strtol(line + 4, nullptr, 10);
+    }
+    else if (len < sizeof(line) - 1)
+      line[len++] = c;
+  }
+  return acked;
+}
+
+MARLIN_TEST(ack_window, batch_limited_to_half_queue) {
+  queue.clear();
+  run_m577(BUFSIZE);
+  read_acks();
+  TEST_ASSERT_EQUAL((BUFSIZE) / 2, GCodeQueue::serial_state[0].ack_batch);
+
+  run_m577(0);
+  read_acks();
+  TEST_ASSERT_EQUAL(0, GCodeQueue::serial_state[0].ack_batch);
+}
+
+MARLIN_TEST(ack_window, host_refills_before_queue_runs_dry) {
+  queue.clear();
+  run_m577(BUFSIZE);
+  read_acks();
+
+  // The host keeps up to L (BUFSIZE) lines unacknowledged and sends more on each "ok N"
+  const long total = 10 * (BUFSIZE);
+  long sent = 0, acked = 0;
+  char cmd[24];
+  while (acked < total) {
+    while (sent < total && sent - acked < BUFSIZE) {
+      sprintf(cmd, "N%li G4 P0", ++sent);
+      TEST_ASSERT_TRUE(queue.ring_buffer.enqueue(cmd, false));
+    }
+
+    // Run one command
+    TEST_ASSERT_TRUE(queue.ring_buffer.occupied());
+    queue.ring_buffer.ok_to_send();
+    queue.ring_buffer.advance_r();
+
+    const long n = read_acks();
+    if (n >= 0) {
+      TEST_ASSERT_TRUE(n > acked);
+      acked = n;
+    }
+
+    // Lines are still coming, so the queue must not have run dry
+    if (sent < total) TEST_ASSERT_TRUE(queue.ring_buffer.occupied());
+  }
+  TEST_ASSERT_EQUAL(total, acked);
+
+  run_m577(0);
+  read_acks();
+}
+
+#endif // SERIAL_ACK_WINDOW
@@ -0,0 +1,86 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(MEATPACK_BINARY_FRAMES)
+
+#include <src/gcode/queue.h>
+
+// MeatPack takes a byte per call when it has nothing to pass on, so read until all are taken
+static void receive(const uint8_t * const bytes, const uint8_t len) {
+  for (uint8_t i = 0; i < len; ++i) MYSERIAL1.receive_buffer.write(bytes[i]);
+  while (MYSERIAL1.receive_buffer.available()) queue.get_available_commands();
+}
+
+static void receive(const char * const text) { receive((const uint8_t*)text, strlen(text)); }
+
+// Send a text frame with the next line number
+static void receive_frame(const char * const text) {
+  const uint8_t tlen = strlen(text);
+  const uint16_t n = GCodeQueue::serial_state[0].last_N + 1;
+  uint8_t frame[64] = { uint8_t(tlen + 3), MPBinary_Text, uint8_t(n & 0xFF), uint8_t(n >> 8) };
+  memcpy(&frame[4], text, tlen);
+  uint8_t checksum = 0;
+  for (uint8_t i = 0; i < tlen + 4; ++i) checksum ^= frame[i];
+  frame[tlen + 4] = checksum;
+  receive(frame, tlen + 5);
+}
+
+// Take the next queued command and check it
+static bool next_command_is(const char * const cmd) {
+  if (!queue.ring_buffer.occupied()) return false;
+  const bool match = !!strstr(queue.ring_buffer.peek_next_command_string(), cmd);
+  queue.ring_buffer.advance_r();
+  return match;
+}
+
+// Two 0xFF bytes start a MeatPack command
+static void send_meatpack_command(const MeatPack_Command c) {
+  const uint8_t cmd[] = { 0xFF, 0xFF, c };
+  receive(cmd, sizeof(cmd));
+}
+
+MARLIN_TEST(meatpack_frames, text_port_ignores_frame_mark) {
+  queue.clear();
+  const uint8_t mark = MeatPack::kFrameMark;
+  receive(&mark, 1);               // Line noise
+  receive("G4 P1\n");
+  TEST_ASSERT_TRUE(next_command_is("G4 P1"));
+  TEST_ASSERT_FALSE(queue.ring_buffer.occupied());
+}
+
+MARLIN_TEST(meatpack_frames, frames_only_while_turned_on) {
+  queue.clear();
+  send_meatpack_command(MPCommand_EnableBinary);
+  receive_frame("G4 P2");
+  TEST_ASSERT_TRUE(next_command_is("G4 P2"));
+
+  send_meatpack_command(MPCommand_DisableBinary);
+  const uint8_t mark = MeatPack::kFrameMark;
+  receive(&mark, 1);
+  receive("G4 P3\n");
+  TEST_ASSERT_TRUE(next_command_is("G4 P3"));
+  TEST_ASSERT_FALSE(queue.ring_buffer.occupied());
+}
+
+#endif // MEATPACK_BINARY_FRAMES
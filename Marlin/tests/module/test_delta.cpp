@@ -0,0 +1,84 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(DELTA_FAST_IK)
+
+#include <src/module/delta.h>
+
+// Stay where every tower can reach, away from nearly flat rods
+static constexpr float test_radius = _MIN(PRINTABLE_RADIUS, (DELTA_DIAGONAL_ROD - DELTA_RADIUS) * 0.8f);
+
+// Float rounding of the carriage heights, on top of the tolerance
+static constexpr float float_slack = 0.00005f;
+
+static void reset_delta_geometry() {
+  delta_radius = DELTA_RADIUS;
+  delta_diagonal_rod = DELTA_DIAGONAL_ROD;
+  delta_tower_angle_trim.reset();
+  delta_diagonal_rod_trim.reset();
+  recalc_delta_settings();
+}
+
+// Repeatable pseudo-random positions in the test area
+static uint32_t seed = 1;
+static float random_mm() {
+  seed = seed * 1664525UL + 1013904223UL;
+  return (float(seed >> 8) / float(1UL << 24) * 2 - 1) * test_radius;
+}
+static xy_pos_t random_xy() {
+  xy_pos_t p;
+  do { p.set(random_mm(), random_mm()); } while (p.magnitude() > test_radius);
+  return p;
+}
+
+// Walk segmented moves between random points and compare every tower to the exact result
+static void check_segments(const float segment_mm) {
+  reset_delta_geometry();
+  xyz_pos_t pos = { 0, 0, 10 };
+  float max_error = 0;
+  for (uint16_t m = 0; m < 500; ++m) {
+    const xy_pos_t start = pos, diff = random_xy() - start;
+    const uint16_t segments = _MAX(1, diff.magnitude() / segment_mm);
+    for (uint16_t s = 1; s <= segments; ++s) {
+      pos.set(start.x + diff.x * s / segments, start.y + diff.y * s / segments);
+      LOOP_ABC(t) {
+        const float fast = delta_fast_tower_z(delta_ik_tower[t], pos), exact = DELTA_Z(pos, t);
+        NOLESS(max_error, ABS(fast - exact));
+      }
+    }
+  }
+  TEST_ASSERT_FLOAT_WITHIN(DELTA_FAST_IK_TOLERANCE + float_slack, 0, max_error);
+}
+
+MARLIN_TEST(delta, fast_ik_short_segments) { check_segments(0.1f); }
+MARLIN_TEST(delta, fast_ik_long_segments) { check_segments(2.0f); }
+
+MARLIN_TEST(delta, fast_ik_exact_after_jump) {
+  reset_delta_geometry();
+  // A long move is beyond one Newton step, so the exact square root is taken
+  const xyz_pos_t far = { test_radius * 0.7f, -test_radius * 0.7f, 5 };
+  LOOP_ABC(t) TEST_ASSERT_EQUAL_FLOAT(DELTA_Z(far, t), delta_fast_tower_z(delta_ik_tower[t], far));
+}
+
+#endif // DELTA_FAST_IK
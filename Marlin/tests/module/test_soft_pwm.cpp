@@ -0,0 +1,94 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+#include <src/module/soft_pwm.h>
+
+constexpr uint8_t outputs = 6;
+
+static bool scheduled[outputs];
+static void write_output(const uint8_t out, const bool on) { scheduled[out] = on; }
+
+/**
+ * Run the schedule next to the per-output soft PWM of Temperature::isr
+ * for a number of periods, changing the duty cycles now and then.
+ * Return the number of ISR ticks where any output differed.
+ */
+static uint32_t compare_with_isr(const uint8_t scale, const bool dither) {
+  const uint8_t step = _BV(scale), mask = dither ? step - 1 : 0;
+  SoftPWMSchedule<outputs> schedule;
+  uint8_t amount[outputs] = { 0, 127, 64, 1, 126, 30 }, count[outputs] = { 0 };
+  bool expected[outputs] = { false };
+  ZERO(scheduled);
+
+  uint32_t seed = 1, mismatches = 0;
+  uint8_t pwm_count = step;
+  for (uint32_t tick = 0; tick < 20000; ++tick) {
+    uint8_t pwm_count_tmp = pwm_count;
+    if (pwm_count_tmp >= 127) {
+      pwm_count_tmp -= 127;
+
+      // New duty cycles every few periods
+      if (!(tick % 512)) for (uint8_t &a : amount) {
+        seed = seed * 1664525UL + 1013904223UL;
+        a = (seed >> 24) & 0x7F;
+      }
+
+      for (uint8_t i = 0; i < outputs; ++i) {
+        count[i] = (count[i] & mask) + amount[i];
+        expected[i] = count[i] > mask;
+      }
+      schedule.start(mask, amount, write_output);
+    }
+    else {
+      for (uint8_t i = 0; i < outputs; ++i) if (count[i] <= pwm_count_tmp) expected[i] = false;
+      schedule.run(pwm_count_tmp, write_output);
+    }
+    pwm_count = pwm_count_tmp + step;
+
+    if (memcmp(expected, scheduled, sizeof(expected))) mismatches++;
+  }
+  return mismatches;
+}
+
+MARLIN_TEST(soft_pwm, schedule_matches_isr) {
+  for (uint8_t scale = 0; scale <= 5; ++scale)
+    TEST_ASSERT_EQUAL(0, compare_with_isr(scale, false));
+}
+
+MARLIN_TEST(soft_pwm, schedule_matches_isr_dither) {
+  for (uint8_t scale = 1; scale <= 5; ++scale)
+    TEST_ASSERT_EQUAL(0, compare_with_isr(scale, true));
+}
+
+MARLIN_TEST(soft_pwm, schedule_writes_each_output_once) {
+  SoftPWMSchedule<outputs> schedule;
+  const uint8_t amount[outputs] = { 10, 10, 0, 127, 50, 5 };
+  static uint8_t writes_off;
+  writes_off = 0;
+  auto count_off = [](const uint8_t, const bool on) { if (!on) writes_off++; };
+
+  schedule.start(0, amount, count_off);
+  TEST_ASSERT_EQUAL(1, writes_off); // The output with no duty is written off at the start
+  for (uint8_t tick = 1; tick < 127; ++tick) schedule.run(tick, count_off);
+  TEST_ASSERT_EQUAL(5, writes_off); // All but the full duty output turn off once
+}
@@ -0,0 +1,176 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2025 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+#include <src/module/thermistor/thermistors.h>
+
+// Every conversion table, not just the configured ones
+#include <src/module/thermistor/thermistor_1.h>
+#include <src/module/thermistor/thermistor_2.h>
+#include <src/module/thermistor/thermistor_3.h>
+#include <src/module/thermistor/thermistor_4.h>
+#include <src/module/thermistor/thermistor_5.h>
+#include <src/module/thermistor/thermistor_6.h>
+#include <src/module/thermistor/thermistor_7.h>
+#include <src/module/thermistor/thermistor_8.h>
+#include <src/module/thermistor/thermistor_9.h>
+#include <src/module/thermistor/thermistor_10.h>
+#include <src/module/thermistor/thermistor_11.h>
+#include <src/module/thermistor/thermistor_12.h>
+#include <src/module/thermistor/thermistor_13.h>
+#include <src/module/thermistor/thermistor_14.h>
+#include <src/module/thermistor/thermistor_15.h>
+#include <src/module/thermistor/thermistor_17.h>
+#include <src/module/thermistor/thermistor_18.h>
+#include <src/module/thermistor/thermistor_20.h>
+#include <src/module/thermistor/thermistor_21.h>
+#include <src/module/thermistor/thermistor_22.h>
+#include <src/module/thermistor/thermistor_23.h>
+#include <src/module/thermistor/thermistor_30.h>
+#include <src/module/thermistor/thermistor_51.h>
+#include <src/module/thermistor/thermistor_52.h>
+#include <src/module/thermistor/thermistor_55.h>
+#include <src/module/thermistor/thermistor_60.h>
+#include <src/module/thermistor/thermistor_61.h>
+#include <src/module/thermistor/thermistor_66.h>
+#include <src/module/thermistor/thermistor_67.h>
+#include <src/module/thermistor/thermistor_68.h>
+#include <src/module/thermistor/thermistor_70.h>
+#include <src/module/thermistor/thermistor_71.h>
+#include <src/module/thermistor/thermistor_75.h>
+#include <src/module/thermistor/thermistor_99.h>
+#include <src/module/thermistor/thermistor_110.h>
+#include <src/module/thermistor/thermistor_147.h>
+#include <src/module/thermistor/thermistor_201.h>
+#include <src/module/thermistor/thermistor_202.h>
+#include <src/module/thermistor/thermistor_331.h>
+#include <src/module/thermistor/thermistor_332.h>
+#include <src/module/thermistor/thermistor_501.h>
+#include <src/module/thermistor/thermistor_502.h>
+#include <src/module/thermistor/thermistor_503.h>
+#include <src/module/thermistor/thermistor_504.h>
+#include <src/module/thermistor/thermistor_505.h>
+#include <src/module/thermistor/thermistor_512.h>
+#include <src/module/thermistor/thermistor_666.h>
+#include <src/module/thermistor/thermistor_998.h>
+#include <src/module/thermistor/thermistor_999.h>
+#include <src/module/thermistor/thermistor_1010.h>
+#include <src/module/thermistor/thermistor_1022.h>
+#include <src/module/thermistor/thermistor_1047.h>
+#include <src/module/thermistor/thermistor_2000.h>
+
+/**
+ * The bisection search used before the grid index, kept as the reference
+ */
+static celsius_float_t bisect_thermistor_table(const temp_entry_t * const tbl, const uint8_t len, const raw_adc_t raw) {
+  uint8_t l = 0, r = len, m;
+  for (;;) {
+    m = (l + r) >> 1;
+    if (!m) return celsius_t(pgm_read_word(&tbl[0].celsius));
+    if (m == l || m == r) return celsius_t(pgm_read_word(&tbl[len - 1].celsius));
+    const raw_adc_t v00 = pgm_read_word(&tbl[m - 1].value),
+                    v10 = pgm_read_word(&tbl[m - 0].value);
+         if (raw < v00) r = m;
+    else if (raw > v10) l = m;
+    else {
+      const celsius_t v01 = celsius_t(pgm_read_word(&tbl[m - 1].celsius)),
+                      v11 = celsius_t(pgm_read_word(&tbl[m - 0].celsius));
+      return v01 + (raw - v00) * float(v11 - v01) / float(v10 - v00);
+    }
+  }
+}
+
+// Compare the grid lookup to the bisection over the full raw range
+template<size_t LEN>
+static void check_thermistor_table(const temp_entry_t (&tbl)[LEN]) {
+  const thermistor_grid_t grid = make_thermistor_grid(tbl);
+  for (uint32_t raw = 0; raw <= MAX_RAW_THERMISTOR_VALUE; ++raw) {
+    TEST_ASSERT_FLOAT_WITHIN(0.1f,
+      bisect_thermistor_table(tbl, LEN, raw_adc_t(raw)),
+      thermistor_table_celsius(tbl, LEN, grid, raw_adc_t(raw))
+    );
+  }
+}
+
+#define THERMISTOR_TABLE_TEST(N) MARLIN_TEST(thermistor, table_##N) { check_thermistor_table(temptable_##N); }
+
+THERMISTOR_TABLE_TEST(1)
+THERMISTOR_TABLE_TEST(2)
+THERMISTOR_TABLE_TEST(3)
+THERMISTOR_TABLE_TEST(4)
+THERMISTOR_TABLE_TEST(5)
+THERMISTOR_TABLE_TEST(6)
+THERMISTOR_TABLE_TEST(7)
+THERMISTOR_TABLE_TEST(8)
+THERMISTOR_TABLE_TEST(9)
+THERMISTOR_TABLE_TEST(10)
+THERMISTOR_TABLE_TEST(11)
+THERMISTOR_TABLE_TEST(12)
+THERMISTOR_TABLE_TEST(13)
+THERMISTOR_TABLE_TEST(14)
+THERMISTOR_TABLE_TEST(15)
+THERMISTOR_TABLE_TEST(17)
+THERMISTOR_TABLE_TEST(18)
+THERMISTOR_TABLE_TEST(20)
+THERMISTOR_TABLE_TEST(21)
+THERMISTOR_TABLE_TEST(22)
+THERMISTOR_TABLE_TEST(23)
+THERMISTOR_TABLE_TEST(30)
+THERMISTOR_TABLE_TEST(51)
+THERMISTOR_TABLE_TEST(52)
+THERMISTOR_TABLE_TEST(55)
+THERMISTOR_TABLE_TEST(60)
+THERMISTOR_TABLE_TEST(61)
+THERMISTOR_TABLE_TEST(66)
+THERMISTOR_TABLE_TEST(67)
+THERMISTOR_TABLE_TEST(68)
+THERMISTOR_TABLE_TEST(70)
+THERMISTOR_TABLE_TEST(71)
+THERMISTOR_TABLE_TEST(75)
+THERMISTOR_TABLE_TEST(99)
+THERMISTOR_TABLE_TEST(110)
+THERMISTOR_TABLE_TEST(147)
+THERMISTOR_TABLE_TEST(201)
+THERMISTOR_TABLE_TEST(202)
+THERMISTOR_TABLE_TEST(331)
+THERMISTOR_TABLE_TEST(332)
+THERMISTOR_TABLE_TEST(501)
+THERMISTOR_TABLE_TEST(502)
+THERMISTOR_TABLE_TEST(503)
+THERMISTOR_TABLE_TEST(504)
+THERMISTOR_TABLE_TEST(505)
+THERMISTOR_TABLE_TEST(512)
+THERMISTOR_TABLE_TEST(666)
+THERMISTOR_TABLE_TEST(998)
+THERMISTOR_TABLE_TEST(999)
+THERMISTOR_TABLE_TEST(1010)
+THERMISTOR_TABLE_TEST(1022)
+THERMISTOR_TABLE_TEST(1047)
+THERMISTOR_TABLE_TEST(2000)
+
+MARLIN_TEST(thermistor, grid_is_constexpr) {
+  // Built at compile time, as for the PROGMEM grids
+  constexpr thermistor_grid_t grid = make_thermistor_grid(temptable_1);
+  TEST_ASSERT_EQUAL(0, grid.index[0]);
+  for (uint8_t c = 1; c < THERMISTOR_GRID_CELLS; ++c)
+    TEST_ASSERT_TRUE(grid.index[c - 1] <= grid.index[c]);
+}
@@ -0,0 +1,716 @@
+;
+; Dense small-segment test print for the planner benchmark
+; Concentric circles at 0.3-0.6mm chords, as emitted by arcs-to-lines
+; slicers, followed by the same walls as G2/G3 arcs.
+;
+
+G21
+G90
+M82
+G92 E0
+M106 S255
+G0 Z0.3 F600
+G0 X115 Y100 F6000
+
+; circle r=15 chord=0.3
+G0 X115.000 Y100.000 F6000
+G1 X114.997 Y100.300 E0.00999 F3000
+G1 X114.988 Y100.600 E0.01999 F3000
+G1 X114.973 Y100.900 E0.02998 F3000
+G1 X114.952 Y101.199 E0.03998 F3000
+G1 X114.925 Y101.498 E0.04997 F3000
+G1 X114.892 Y101.797 E0.05997 F3000
+G1 X114.853 Y102.094 E0.06996 F3000
+G1 X114.808 Y102.391 E0.07996 F3000
+G1 X114.757 Y102.687 E0.08995 F3000
+G1 X114.701 Y102.982 E0.09995 F3000
+G1 X114.638 Y103.275 E0.10994 F3000
+G1 X114.570 Y103.567 E0.11994 F3000
+G1 X114.495 Y103.858 E0.12993 F3000
+G1 X114.415 Y104.147 E0.13993 F3000
+G1 X114.329 Y104.435 E0.14992 F3000
+G1 X114.238 Y104.721 E0.15992 F3000
+G1 X114.140 Y105.005 E0.16991 F3000
+G1 X114.037 Y105.287 E0.17991 F3000
+G1 X113.929 Y105.566 E0.18990 F3000
+G1 X113.815 Y105.844 E0.19990 F3000
+G1 X113.695 Y106.119 E0.20989 F3000
+G1 X113.570 Y106.392 E0.21989 F3000
+G1 X113.439 Y106.662 E0.22988 F3000
+G1 X113.303 Y106.930 E0.23988 F3000
+G1 X113.162 Y107.195 E0.24987 F3000
+G1 X113.015 Y107.457 E0.25987 F3000
+G1 X112.864 Y107.716 E0.26986 F3000
+G1 X112.707 Y107.971 E0.27986 F3000
+G1 X112.545 Y108.224 E0.28985 F3000
+G1 X112.377 Y108.473 E0.29985 F3000
+G1 X112.205 Y108.719 E0.30984 F3000
+G1 X112.029 Y108.962 E0.31984 F3000
+G1 X111.847 Y109.201 E0.32983 F3000
+G1 X111.660 Y109.436 E0.33983 F3000
+G1 X111.469 Y109.667 E0.34982 F3000
+G1 X111.273 Y109.895 E0.35982 F3000
+G1 X111.073 Y110.118 E0.36981 F3000
+G1 X110.869 Y110.338 E0.37981 F3000
+G1 X110.660 Y110.553 E0.38980 F3000
+G1 X110.446 Y110.765 E0.39980 F3000
+G1 X110.229 Y110.971 E0.40979 F3000
+G1 X110.007 Y111.174 E0.41979 F3000
+G1 X109.782 Y111.372 E0.42978 F3000
+G1 X109.552 Y111.565 E0.43978 F3000
+G1 X109.319 Y111.754 E0.44977 F3000
+G1 X109.082 Y111.938 E0.45977 F3000
+G1 X108.841 Y112.118 E0.46976 F3000
+G1 X108.597 Y112.292 E0.47976 F3000
+G1 X108.349 Y112.462 E0.48975 F3000
+G1 X108.098 Y112.626 E0.49975 F3000
+G1 X107.844 Y112.786 E0.50974 F3000
+G1 X107.586 Y112.940 E0.51973 F3000
+G1 X107.326 Y113.089 E0.52973 F3000
+G1 X107.063 Y113.233 E0.53972 F3000
+G1 X106.796 Y113.372 E0.54972 F3000
+G1 X106.528 Y113.505 E0.55971 F3000
+G1 X106.256 Y113.633 E0.56971 F3000
+G1 X105.982 Y113.756 E0.57970 F3000
+G1 X105.706 Y113.873 E0.58970 F3000
+G1 X105.427 Y113.984 E0.59969 F3000
+G1 X105.146 Y114.090 E0.60969 F3000
+G1 X104.863 Y114.190 E0.61968 F3000
+G1 X104.578 Y114.284 E0.62968 F3000
+G1 X104.291 Y114.373 E0.63967 F3000
+G1 X104.003 Y114.456 E0.64967 F3000
+G1 X103.713 Y114.533 E0.65966 F3000
+G1 X103.421 Y114.605 E0.66966 F3000
+G1 X103.128 Y114.670 E0.67965 F3000
+G1 X102.834 Y114.730 E0.68965 F3000
+G1 X102.539 Y114.784 E0.69964 F3000
+G1 X102.243 Y114.831 E0.70964 F3000
+G1 X101.945 Y114.873 E0.71963 F3000
+G1 X101.648 Y114.909 E0.72963 F3000
+G1 X101.349 Y114.939 E0.73962 F3000
+G1 X101.050 Y114.963 E0.74962 F3000
+G1 X100.750 Y114.981 E0.75961 F3000
+G1 X100.450 Y114.993 E0.76961 F3000
+G1 X100.150 Y114.999 E0.77960 F3000
+G1 X99.850 Y114.999 E0.78960 F3000
+G1 X99.550 Y114.993 E0.79959 F3000
+G1 X99.250 Y114.981 E0.80959 F3000
+G1 X98.950 Y114.963 E0.81958 F3000
+G1 X98.651 Y114.939 E0.82958 F3000
+G1 X98.352 Y114.909 E0.83957 F3000
+G1 X98.055 Y114.873 E0.84957 F3000
+G1 X97.757 Y114.831 E0.85956 F3000
+G1 X97.461 Y114.784 E0.86956 F3000
+G1 X97.166 Y114.730 E0.87955 F3000
+G1 X96.872 Y114.670 E0.88955 F3000
+G1 X96.579 Y114.605 E0.89954 F3000
+G1 X96.287 Y114.533 E0.90954 F3000
+G1 X95.997 Y114.456 E0.91953 F3000
+G1 X95.709 Y114.373 E0.92953 F3000
+G1 X95.422 Y114.284 E0.93952 F3000
+G1 X95.137 Y114.190 E0.94952 F3000
+G1 X94.854 Y114.090 E0.95951 F3000
+G1 X94.573 Y113.984 E0.96951 F3000
+G1 X94.294 Y113.873 E0.97950 F3000
+G1 X94.018 Y113.756 E0.98950 F3000
+G1 X93.744 Y113.633 E0.99949 F3000
+G1 X93.472 Y113.505 E1.00948 F3000
+G1 X93.204 Y113.372 E1.01948 F3000
+G1 X92.937 Y113.233 E1.02947 F3000
+G1 X92.674 Y113.089 E1.03947 F3000
+G1 X92.414 Y112.940 E1.04946 F3000
+G1 X92.156 Y112.786 E1.05946 F3000
+G1 X91.902 Y112.626 E1.06945 F3000
+G1 X91.651 Y112.462 E1.07945 F3000
+G1 X91.403 Y112.292 E1.08944 F3000
+G1 X91.159 Y112.118 E1.09944 F3000
+G1 X90.918 Y111.938 E1.10943 F3000
+G1 X90.681 Y111.754 E1.11943 F3000
+G1 X90.448 Y111.565 E1.12942 F3000
+G1 X90.218 Y111.372 E1.13942 F3000
+G1 X89.993 Y111.174 E1.14941 F3000
+G1 X89.771 Y110.971 E1.15941 F3000
+G1 X89.554 Y110.765 E1.16940 F3000
+G1 X89.340 Y110.553 E1.17940 F3000
+G1 X89.131 Y110.338 E1.18939 F3000
+G1 X88.927 Y110.118 E1.19939 F3000
+G1 X88.727 Y109.895 E1.20938 F3000
+G1 X88.531 Y109.667 E1.21938 F3000
+G1 X88.340 Y109.436 E1.22937 F3000
+G1 X88.153 Y109.201 E1.23937 F3000
+G1 X87.971 Y108.962 E1.24936 F3000
+G1 X87.795 Y108.719 E1.25936 F3000
+G1 X87.623 Y108.473 E1.26935 F3000
+G1 X87.455 Y108.224 E1.27935 F3000
+G1 X87.293 Y107.971 E1.28934 F3000
+G1 X87.136 Y107.716 E1.29934 F3000
+G1 X86.985 Y107.457 E1.30933 F3000
+G1 X86.838 Y107.195 E1.31933 F3000
+G1 X86.697 Y106.930 E1.32932 F3000
+G1 X86.561 Y106.662 E1.33932 F3000
+G1 X86.430 Y106.392 E1.34931 F3000
+G1 X86.305 Y106.119 E1.35931 F3000
+G1 X86.185 Y105.844 E1.36930 F3000
+G1 X86.071 Y105.566 E1.37930 F3000
+G1 X85.963 Y105.287 E1.38929 F3000
+G1 X85.860 Y105.005 E1.39929 F3000
+G1 X85.762 Y104.721 E1.40928 F3000
+G1 X85.671 Y104.435 E1.41928 F3000
+G1 X85.585 Y104.147 E1.42927 F3000
+G1 X85.505 Y103.858 E1.43927 F3000
+G1 X85.430 Y103.567 E1.44926 F3000
+G1 X85.362 Y103.275 E1.45926 F3000
+G1 X85.299 Y102.982 E1.46925 F3000
+G1 X85.243 Y102.687 E1.47925 F3000
+G1 X85.192 Y102.391 E1.48924 F3000
+G1 X85.147 Y102.094 E1.49924 F3000
+G1 X85.108 Y101.797 E1.50923 F3000
+G1 X85.075 Y101.498 E1.51922 F3000
+G1 X85.048 Y101.199 E1.52922 F3000
+G1 X85.027 Y100.900 E1.53921 F3000
+G1 X85.012 Y100.600 E1.54921 F3000
+G1 X85.003 Y100.300 E1.55920 F3000
+G1 X85.000 Y100.000 E1.56920 F3000
+G1 X85.003 Y99.700 E1.57919 F3000
+G1 X85.012 Y99.400 E1.58919 F3000
+G1 X85.027 Y99.100 E1.59918 F3000
+G1 X85.048 Y98.801 E1.60918 F3000
+G1 X85.075 Y98.502 E1.61917 F3000
+G1 X85.108 Y98.203 E1.62917 F3000
+G1 X85.147 Y97.906 E1.63916 F3000
+G1 X85.192 Y97.609 E1.64916 F3000
+G1 X85.243 Y97.313 E1.65915 F3000
+G1 X85.299 Y97.018 E1.66915 F3000
+G1 X85.362 Y96.725 E1.67914 F3000
+G1 X85.430 Y96.433 E1.68914 F3000
+G1 X85.505 Y96.142 E1.69913 F3000
+G1 X85.585 Y95.853 E1.70913 F3000
+G1 X85.671 Y95.565 E1.71912 F3000
+G1 X85.762 Y95.279 E1.72912 F3000
+G1 X85.860 Y94.995 E1.73911 F3000
+G1 X85.963 Y94.713 E1.74911 F3000
+G1 X86.071 Y94.434 E1.75910 F3000
+G1 X86.185 Y94.156 E1.76910 F3000
+G1 X86.305 Y93.881 E1.77909 F3000
+G1 X86.430 Y93.608 E1.78909 F3000
+G1 X86.561 Y93.338 E1.79908 F3000
+G1 X86.697 Y93.070 E1.80908 F3000
+G1 X86.838 Y92.805 E1.81907 F3000
+G1 X86.985 Y92.543 E1.82907 F3000
+G1 X87.136 Y92.284 E1.83906 F3000
+G1 X87.293 Y92.029 E1.84906 F3000
+G1 X87.455 Y91.776 E1.85905 F3000
+G1 X87.623 Y91.527 E1.86905 F3000
+G1 X87.795 Y91.281 E1.87904 F3000
+G1 X87.971 Y91.038 E1.88904 F3000
+G1 X88.153 Y90.799 E1.89903 F3000
+G1 X88.340 Y90.564 E1.90903 F3000
+G1 X88.531 Y90.333 E1.91902 F3000
+G1 X88.727 Y90.105 E1.92902 F3000
+G1 X88.927 Y89.882 E1.93901 F3000
+G1 X89.131 Y89.662 E1.94901 F3000
+G1 X89.340 Y89.447 E1.95900 F3000
+G1 X89.554 Y89.235 E1.96900 F3000
+G1 X89.771 Y89.029 E1.97899 F3000
+G1 X89.993 Y88.826 E1.98899 F3000
+G1 X90.218 Y88.628 E1.99898 F3000
+G1 X90.448 Y88.435 E2.00897 F3000
+G1 X90.681 Y88.246 E2.01897 F3000
+G1 X90.918 Y88.062 E2.02896 F3000
+G1 X91.159 Y87.882 E2.03896 F3000
+G1 X91.403 Y87.708 E2.04895 F3000
+G1 X91.651 Y87.538 E2.05895 F3000
+G1 X91.902 Y87.374 E2.06894 F3000
+G1 X92.156 Y87.214 E2.07894 F3000
+G1 X92.414 Y87.060 E2.08893 F3000
+G1 X92.674 Y86.911 E2.09893 F3000
+G1 X92.937 Y86.767 E2.10892 F3000
+G1 X93.204 Y86.628 E2.11892 F3000
+G1 X93.472 Y86.495 E2.12891 F3000
+G1 X93.744 Y86.367 E2.13891 F3000
+G1 X94.018 Y86.244 E2.14890 F3000
+G1 X94.294 Y86.127 E2.15890 F3000
+G1 X94.573 Y86.016 E2.16889 F3000
+G1 X94.854 Y85.910 E2.17889 F3000
+G1 X95.137 Y85.810 E2.18888 F3000
+G1 X95.422 Y85.716 E2.19888 F3000
+G1 X95.709 Y85.627 E2.20887 F3000
+G1 X95.997 Y85.544 E2.21887 F3000
+G1 X96.287 Y85.467 E2.22886 F3000
+G1 X96.579 Y85.395 E2.23886 F3000
+G1 X96.872 Y85.330 E2.24885 F3000
+G1 X97.166 Y85.270 E2.25885 F3000
+G1 X97.461 Y85.216 E2.26884 F3000
+G1 X97.757 Y85.169 E2.27884 F3000
+G1 X98.055 Y85.127 E2.28883 F3000
+G1 X98.352 Y85.091 E2.29883 F3000
+G1 X98.651 Y85.061 E2.30882 F3000
+G1 X98.950 Y85.037 E2.31882 F3000
+G1 X99.250 Y85.019 E2.32881 F3000
+G1 X99.550 Y85.007 E2.33881 F3000
+G1 X99.850 Y85.001 E2.34880 F3000
+G1 X100.150 Y85.001 E2.35880 F3000
+G1 X100.450 Y85.007 E2.36879 F3000
+G1 X100.750 Y85.019 E2.37879 F3000
+G1 X101.050 Y85.037 E2.38878 F3000
+G1 X101.349 Y85.061 E2.39878 F3000
+G1 X101.648 Y85.091 E2.40877 F3000
+G1 X101.945 Y85.127 E2.41877 F3000
+G1 X102.243 Y85.169 E2.42876 F3000
+G1 X102.539 Y85.216 E2.43876 F3000
+G1 X102.834 Y85.270 E2.44875 F3000
+G1 X103.128 Y85.330 E2.45875 F3000
+G1 X103.421 Y85.395 E2.46874 F3000
+G1 X103.713 Y85.467 E2.47874 F3000
+G1 X104.003 Y85.544 E2.48873 F3000
+G1 X104.291 Y85.627 E2.49873 F3000
+G1 X104.578 Y85.716 E2.50872 F3000
+G1 X104.863 Y85.810 E2.51871 F3000
+G1 X105.146 Y85.910 E2.52871 F3000
+G1 X105.427 Y86.016 E2.53870 F3000
+G1 X105.706 Y86.127 E2.54870 F3000
+G1 X105.982 Y86.244 E2.55869 F3000
+G1 X106.256 Y86.367 E2.56869 F3000
+G1 X106.528 Y86.495 E2.57868 F3000
+G1 X106.796 Y86.628 E2.58868 F3000
+G1 X107.063 Y86.767 E2.59867 F3000
+G1 X107.326 Y86.911 E2.60867 F3000
+G1 X107.586 Y87.060 E2.61866 F3000
+G1 X107.844 Y87.214 E2.62866 F3000
+G1 X108.098 Y87.374 E2.63865 F3000
+G1 X108.349 Y87.538 E2.64865 F3000
+G1 X108.597 Y87.708 E2.65864 F3000
+G1 X108.841 Y87.882 E2.66864 F3000
+G1 X109.082 Y88.062 E2.67863 F3000
+G1 X109.319 Y88.246 E2.68863 F3000
+G1 X109.552 Y88.435 E2.69862 F3000
+G1 X109.782 Y88.628 E2.70862 F3000
+G1 X110.007 Y88.826 E2.71861 F3000
+G1 X110.229 Y89.029 E2.72861 F3000
+G1 X110.446 Y89.235 E2.73860 F3000
+G1 X110.660 Y89.447 E2.74860 F3000
+G1 X110.869 Y89.662 E2.75859 F3000
+G1 X111.073 Y89.882 E2.76859 F3000
+G1 X111.273 Y90.105 E2.77858 F3000
+G1 X111.469 Y90.333 E2.78858 F3000
+G1 X111.660 Y90.564 E2.79857 F3000
+G1 X111.847 Y90.799 E2.80857 F3000
+G1 X112.029 Y91.038 E2.81856 F3000
+G1 X112.205 Y91.281 E2.82856 F3000
+G1 X112.377 Y91.527 E2.83855 F3000
+G1 X112.545 Y91.776 E2.84855 F3000
+G1 X112.707 Y92.029 E2.85854 F3000
+G1 X112.864 Y92.284 E2.86854 F3000
+G1 X113.015 Y92.543 E2.87853 F3000
+G1 X113.162 Y92.805 E2.88853 F3000
+G1 X113.303 Y93.070 E2.89852 F3000
+G1 X113.439 Y93.338 E2.90852 F3000
+G1 X113.570 Y93.608 E2.91851 F3000
+G1 X113.695 Y93.881 E2.92851 F3000
+G1 X113.815 Y94.156 E2.93850 F3000
+G1 X113.929 Y94.434 E2.94850 F3000
+G1 X114.037 Y94.713 E2.95849 F3000
+G1 X114.140 Y94.995 E2.96849 F3000
+G1 X114.238 Y95.279 E2.97848 F3000
+G1 X114.329 Y95.565 E2.98848 F3000
+G1 X114.415 Y95.853 E2.99847 F3000
+G1 X114.495 Y96.142 E3.00846 F3000
+G1 X114.570 Y96.433 E3.01846 F3000
+G1 X114.638 Y96.725 E3.02845 F3000
+G1 X114.701 Y97.018 E3.03845 F3000
+G1 X114.757 Y97.313 E3.04844 F3000
+G1 X114.808 Y97.609 E3.05844 F3000
+G1 X114.853 Y97.906 E3.06843 F3000
+G1 X114.892 Y98.203 E3.07843 F3000
+G1 X114.925 Y98.502 E3.08842 F3000
+G1 X114.952 Y98.801 E3.09842 F3000
+G1 X114.973 Y99.100 E3.10841 F3000
+G1 X114.988 Y99.400 E3.11841 F3000
+G1 X114.997 Y99.700 E3.12840 F3000
+G1 X115.000 Y100.000 E3.13840 F3000
+
+; circle r=12 chord=0.4
+G0 X112.000 Y100.000 F6000
+G1 X111.993 Y100.401 E3.15175 F3000
+G1 X111.973 Y100.802 E3.16511 F3000
+G1 X111.940 Y101.201 E3.17846 F3000
+G1 X111.893 Y101.599 E3.19182 F3000
+G1 X111.833 Y101.996 E3.20517 F3000
+G1 X111.760 Y102.390 E3.21853 F3000
+G1 X111.673 Y102.782 E3.23188 F3000
+G1 X111.574 Y103.170 E3.24523 F3000
+G1 X111.461 Y103.555 E3.25859 F3000
+G1 X111.336 Y103.936 E3.27194 F3000
+G1 X111.198 Y104.313 E3.28530 F3000
+G1 X111.048 Y104.685 E3.29865 F3000
+G1 X110.885 Y105.051 E3.31201 F3000
+G1 X110.710 Y105.412 E3.32536 F3000
+G1 X110.523 Y105.767 E3.33872 F3000
+G1 X110.325 Y106.115 E3.35207 F3000
+G1 X110.115 Y106.457 E3.36543 F3000
+G1 X109.893 Y106.791 E3.37878 F3000
+G1 X109.661 Y107.118 E3.39213 F3000
+G1 X109.418 Y107.437 E3.40549 F3000
+G1 X109.164 Y107.748 E3.41884 F3000
+G1 X108.900 Y108.049 E3.43220 F3000
+G1 X108.626 Y108.342 E3.44555 F3000
+G1 X108.342 Y108.626 E3.45891 F3000
+G1 X108.049 Y108.900 E3.47226 F3000
+G1 X107.748 Y109.164 E3.48562 F3000
+G1 X107.437 Y109.418 E3.49897 F3000
+G1 X107.118 Y109.661 E3.51232 F3000
+G1 X106.791 Y109.893 E3.52568 F3000
+G1 X106.457 Y110.115 E3.53903 F3000
+G1 X106.115 Y110.325 E3.55239 F3000
+G1 X105.767 Y110.523 E3.56574 F3000
+G1 X105.412 Y110.710 E3.57910 F3000
+G1 X105.051 Y110.885 E3.59245 F3000
+G1 X104.685 Y111.048 E3.60581 F3000
+G1 X104.313 Y111.198 E3.61916 F3000
+G1 X103.936 Y111.336 E3.63251 F3000
+G1 X103.555 Y111.461 E3.64587 F3000
+G1 X103.170 Y111.574 E3.65922 F3000
+G1 X102.782 Y111.673 E3.67258 F3000
+G1 X102.390 Y111.760 E3.68593 F3000
+G1 X101.996 Y111.833 E3.69929 F3000
+G1 X101.599 Y111.893 E3.71264 F3000
+G1 X101.201 Y111.940 E3.72600 F3000
+G1 X100.802 Y111.973 E3.73935 F3000
+G1 X100.401 Y111.993 E3.75271 F3000
+G1 X100.000 Y112.000 E3.76606 F3000
+G1 X99.599 Y111.993 E3.77941 F3000
+G1 X99.198 Y111.973 E3.79277 F3000
+G1 X98.799 Y111.940 E3.80612 F3000
+G1 X98.401 Y111.893 E3.81948 F3000
+G1 X98.004 Y111.833 E3.83283 F3000
+G1 X97.610 Y111.760 E3.84619 F3000
+G1 X97.218 Y111.673 E3.85954 F3000
+G1 X96.830 Y111.574 E3.87290 F3000
+G1 X96.445 Y111.461 E3.88625 F3000
+G1 X96.064 Y111.336 E3.89960 F3000
+G1 X95.687 Y111.198 E3.91296 F3000
+G1 X95.315 Y111.048 E3.92631 F3000
+G1 X94.949 Y110.885 E3.93967 F3000
+G1 X94.588 Y110.710 E3.95302 F3000
+G1 X94.233 Y110.523 E3.96638 F3000
+G1 X93.885 Y110.325 E3.97973 F3000
+G1 X93.543 Y110.115 E3.99309 F3000
+G1 X93.209 Y109.893 E4.00644 F3000
+G1 X92.882 Y109.661 E4.01979 F3000
+G1 X92.563 Y109.418 E4.03315 F3000
+G1 X92.252 Y109.164 E4.04650 F3000
+G1 X91.951 Y108.900 E4.05986 F3000
+G1 X91.658 Y108.626 E4.07321 F3000
+G1 X91.374 Y108.342 E4.08657 F3000
+G1 X91.100 Y108.049 E4.09992 F3000
+G1 X90.836 Y107.748 E4.11328 F3000
+G1 X90.582 Y107.437 E4.12663 F3000
+G1 X90.339 Y107.118 E4.13999 F3000
+G1 X90.107 Y106.791 E4.15334 F3000
+G1 X89.885 Y106.457 E4.16669 F3000
+G1 X89.675 Y106.115 E4.18005 F3000
+G1 X89.477 Y105.767 E4.19340 F3000
+G1 X89.290 Y105.412 E4.20676 F3000
+G1 X89.115 Y105.051 E4.22011 F3000
+G1 X88.952 Y104.685 E4.23347 F3000
+G1 X88.802 Y104.313 E4.24682 F3000
+G1 X88.664 Y103.936 E4.26018 F3000
+G1 X88.539 Y103.555 E4.27353 F3000
+G1 X88.426 Y103.170 E4.28688 F3000
+G1 X88.327 Y102.782 E4.30024 F3000
+G1 X88.240 Y102.390 E4.31359 F3000
+G1 X88.167 Y101.996 E4.32695 F3000
+G1 X88.107 Y101.599 E4.34030 F3000
+G1 X88.060 Y101.201 E4.35366 F3000
+G1 X88.027 Y100.802 E4.36701 F3000
+G1 X88.007 Y100.401 E4.38037 F3000
+G1 X88.000 Y100.000 E4.39372 F3000
+G1 X88.007 Y99.599 E4.40708 F3000
+G1 X88.027 Y99.198 E4.42043 F3000
+G1 X88.060 Y98.799 E4.43378 F3000
+G1 X88.107 Y98.401 E4.44714 F3000
+G1 X88.167 Y98.004 E4.46049 F3000
+G1 X88.240 Y97.610 E4.47385 F3000
+G1 X88.327 Y97.218 E4.48720 F3000
+G1 X88.426 Y96.830 E4.50056 F3000
+G1 X88.539 Y96.445 E4.51391 F3000
+G1 X88.664 Y96.064 E4.52727 F3000
+G1 X88.802 Y95.687 E4.54062 F3000
+G1 X88.952 Y95.315 E4.55397 F3000
+G1 X89.115 Y94.949 E4.56733 F3000
+G1 X89.290 Y94.588 E4.58068 F3000
+G1 X89.477 Y94.233 E4.59404 F3000
+G1 X89.675 Y93.885 E4.60739 F3000
+G1 X89.885 Y93.543 E4.62075 F3000
+G1 X90.107 Y93.209 E4.63410 F3000
+G1 X90.339 Y92.882 E4.64746 F3000
+G1 X90.582 Y92.563 E4.66081 F3000
+G1 X90.836 Y92.252 E4.67416 F3000
+G1 X91.100 Y91.951 E4.68752 F3000
+G1 X91.374 Y91.658 E4.70087 F3000
+G1 X91.658 Y91.374 E4.71423 F3000
+G1 X91.951 Y91.100 E4.72758 F3000
+G1 X92.252 Y90.836 E4.74094 F3000
+G1 X92.563 Y90.582 E4.75429 F3000
+G1 X92.882 Y90.339 E4.76765 F3000
+G1 X93.209 Y90.107 E4.78100 F3000
+G1 X93.543 Y89.885 E4.79436 F3000
+G1 X93.885 Y89.675 E4.80771 F3000
+G1 X94.233 Y89.477 E4.82106 F3000
+G1 X94.588 Y89.290 E4.83442 F3000
+G1 X94.949 Y89.115 E4.84777 F3000
+G1 X95.315 Y88.952 E4.86113 F3000
+G1 X95.687 Y88.802 E4.87448 F3000
+G1 X96.064 Y88.664 E4.88784 F3000
+G1 X96.445 Y88.539 E4.90119 F3000
+G1 X96.830 Y88.426 E4.91455 F3000
+G1 X97.218 Y88.327 E4.92790 F3000
+G1 X97.610 Y88.240 E4.94125 F3000
+G1 X98.004 Y88.167 E4.95461 F3000
+G1 X98.401 Y88.107 E4.96796 F3000
+G1 X98.799 Y88.060 E4.98132 F3000
+G1 X99.198 Y88.027 E4.99467 F3000
+G1 X99.599 Y88.007 E5.00803 F3000
+G1 X100.000 Y88.000 E5.02138 F3000
+G1 X100.401 Y88.007 E5.03474 F3000
+G1 X100.802 Y88.027 E5.04809 F3000
+G1 X101.201 Y88.060 E5.06145 F3000
+G1 X101.599 Y88.107 E5.07480 F3000
+G1 X101.996 Y88.167 E5.08815 F3000
+G1 X102.390 Y88.240 E5.10151 F3000
+G1 X102.782 Y88.327 E5.11486 F3000
+G1 X103.170 Y88.426 E5.12822 F3000
+G1 X103.555 Y88.539 E5.14157 F3000
+G1 X103.936 Y88.664 E5.15493 F3000
+G1 X104.313 Y88.802 E5.16828 F3000
+G1 X104.685 Y88.952 E5.18164 F3000
+G1 X105.051 Y89.115 E5.19499 F3000
+G1 X105.412 Y89.290 E5.20834 F3000
+G1 X105.767 Y89.477 E5.22170 F3000
+G1 X106.115 Y89.675 E5.23505 F3000
+G1 X106.457 Y89.885 E5.24841 F3000
+G1 X106.791 Y90.107 E5.26176 F3000
+G1 X107.118 Y90.339 E5.27512 F3000
+G1 X107.437 Y90.582 E5.28847 F3000
+G1 X107.748 Y90.836 E5.30183 F3000
+G1 X108.049 Y91.100 E5.31518 F3000
+G1 X108.342 Y91.374 E5.32853 F3000
+G1 X108.626 Y91.658 E5.34189 F3000
+G1 X108.900 Y91.951 E5.35524 F3000
+G1 X109.164 Y92.252 E5.36860 F3000
+G1 X109.418 Y92.563 E5.38195 F3000
+G1 X109.661 Y92.882 E5.39531 F3000
+G1 X109.893 Y93.209 E5.40866 F3000
+G1 X110.115 Y93.543 E5.42202 F3000
+G1 X110.325 Y93.885 E5.43537 F3000
+G1 X110.523 Y94.233 E5.44873 F3000
+G1 X110.710 Y94.588 E5.46208 F3000
+G1 X110.885 Y94.949 E5.47543 F3000
+G1 X111.048 Y95.315 E5.48879 F3000
+G1 X111.198 Y95.687 E5.50214 F3000
+G1 X111.336 Y96.064 E5.51550 F3000
+G1 X111.461 Y96.445 E5.52885 F3000
+G1 X111.574 Y96.830 E5.54221 F3000
+G1 X111.673 Y97.218 E5.55556 F3000
+G1 X111.760 Y97.610 E5.56892 F3000
+G1 X111.833 Y98.004 E5.58227 F3000
+G1 X111.893 Y98.401 E5.59562 F3000
+G1 X111.940 Y98.799 E5.60898 F3000
+G1 X111.973 Y99.198 E5.62233 F3000
+G1 X111.993 Y99.599 E5.63569 F3000
+G1 X112.000 Y100.000 E5.64904 F3000
+
+; circle r=9 chord=0.5
+G0 X109.000 Y100.000 F6000
+G1 X108.986 Y100.500 E5.66570 F3000
+G1 X108.944 Y100.999 E5.68237 F3000
+G1 X108.875 Y101.494 E5.69903 F3000
+G1 X108.778 Y101.985 E5.71569 F3000
+G1 X108.654 Y102.470 E5.73235 F3000
+G1 X108.504 Y102.947 E5.74902 F3000
+G1 X108.327 Y103.415 E5.76568 F3000
+G1 X108.124 Y103.873 E5.78234 F3000
+G1 X107.896 Y104.318 E5.79900 F3000
+G1 X107.644 Y104.750 E5.81566 F3000
+G1 X107.368 Y105.168 E5.83233 F3000
+G1 X107.070 Y105.569 E5.84899 F3000
+G1 X106.749 Y105.954 E5.86565 F3000
+G1 X106.408 Y106.320 E5.88231 F3000
+G1 X106.047 Y106.666 E5.89898 F3000
+G1 X105.667 Y106.992 E5.91564 F3000
+G1 X105.270 Y107.296 E5.93230 F3000
+G1 X104.856 Y107.577 E5.94896 F3000
+G1 X104.428 Y107.836 E5.96562 F3000
+G1 X103.985 Y108.070 E5.98229 F3000
+G1 X103.531 Y108.279 E5.99895 F3000
+G1 X103.065 Y108.462 E6.01561 F3000
+G1 X102.590 Y108.619 E6.03227 F3000
+G1 X102.107 Y108.750 E6.04894 F3000
+G1 X101.618 Y108.853 E6.06560 F3000
+G1 X101.123 Y108.930 E6.08226 F3000
+G1 X100.625 Y108.978 E6.09892 F3000
+G1 X100.125 Y108.999 E6.11558 F3000
+G1 X99.625 Y108.992 E6.13225 F3000
+G1 X99.126 Y108.957 E6.14891 F3000
+G1 X98.629 Y108.895 E6.16557 F3000
+G1 X98.137 Y108.805 E6.18223 F3000
+G1 X97.650 Y108.688 E6.19890 F3000
+G1 X97.171 Y108.544 E6.21556 F3000
+G1 X96.701 Y108.374 E6.23222 F3000
+G1 X96.241 Y108.177 E6.24888 F3000
+G1 X95.792 Y107.956 E6.26554 F3000
+G1 X95.356 Y107.709 E6.28221 F3000
+G1 X94.935 Y107.440 E6.29887 F3000
+G1 X94.529 Y107.147 E6.31553 F3000
+G1 X94.141 Y106.831 E6.33219 F3000
+G1 X93.770 Y106.495 E6.34885 F3000
+G1 X93.419 Y106.139 E6.36552 F3000
+G1 X93.088 Y105.764 E6.38218 F3000
+G1 X92.778 Y105.371 E6.39884 F3000
+G1 X92.491 Y104.961 E6.41550 F3000
+G1 X92.227 Y104.536 E6.43217 F3000
+G1 X91.987 Y104.097 E6.44883 F3000
+G1 X91.771 Y103.645 E6.46549 F3000
+G1 X91.581 Y103.182 E6.48215 F3000
+G1 X91.418 Y102.710 E6.49881 F3000
+G1 X91.280 Y102.229 E6.51548 F3000
+G1 X91.170 Y101.740 E6.53214 F3000
+G1 X91.087 Y101.247 E6.54880 F3000
+G1 X91.031 Y100.750 E6.56546 F3000
+G1 X91.003 Y100.250 E6.58213 F3000
+G1 X91.003 Y99.750 E6.59879 F3000
+G1 X91.031 Y99.250 E6.61545 F3000
+G1 X91.087 Y98.753 E6.63211 F3000
+G1 X91.170 Y98.260 E6.64877 F3000
+G1 X91.280 Y97.771 E6.66544 F3000
+G1 X91.418 Y97.290 E6.68210 F3000
+G1 X91.581 Y96.818 E6.69876 F3000
+G1 X91.771 Y96.355 E6.71542 F3000
+G1 X91.987 Y95.903 E6.73209 F3000
+G1 X92.227 Y95.464 E6.74875 F3000
+G1 X92.491 Y95.039 E6.76541 F3000
+G1 X92.778 Y94.629 E6.78207 F3000
+G1 X93.088 Y94.236 E6.79873 F3000
+G1 X93.419 Y93.861 E6.81540 F3000
+G1 X93.770 Y93.505 E6.83206 F3000
+G1 X94.141 Y93.169 E6.84872 F3000
+G1 X94.529 Y92.853 E6.86538 F3000
+G1 X94.935 Y92.560 E6.88205 F3000
+G1 X95.356 Y92.291 E6.89871 F3000
+G1 X95.792 Y92.044 E6.91537 F3000
+G1 X96.241 Y91.823 E6.93203 F3000
+G1 X96.701 Y91.626 E6.94869 F3000
+G1 X97.171 Y91.456 E6.96536 F3000
+G1 X97.650 Y91.312 E6.98202 F3000
+G1 X98.137 Y91.195 E6.99868 F3000
+G1 X98.629 Y91.105 E7.01534 F3000
+G1 X99.126 Y91.043 E7.03200 F3000
+G1 X99.625 Y91.008 E7.04867 F3000
+G1 X100.125 Y91.001 E7.06533 F3000
+G1 X100.625 Y91.022 E7.08199 F3000
+G1 X101.123 Y91.070 E7.09865 F3000
+G1 X101.618 Y91.147 E7.11532 F3000
+G1 X102.107 Y91.250 E7.13198 F3000
+G1 X102.590 Y91.381 E7.14864 F3000
+G1 X103.065 Y91.538 E7.16530 F3000
+G1 X103.531 Y91.721 E7.18196 F3000
+G1 X103.985 Y91.930 E7.19863 F3000
+G1 X104.428 Y92.164 E7.21529 F3000
+G1 X104.856 Y92.423 E7.23195 F3000
+G1 X105.270 Y92.704 E7.24861 F3000
+G1 X105.667 Y93.008 E7.26528 F3000
+G1 X106.047 Y93.334 E7.28194 F3000
+G1 X106.408 Y93.680 E7.29860 F3000
+G1 X106.749 Y94.046 E7.31526 F3000
+G1 X107.070 Y94.431 E7.33192 F3000
+G1 X107.368 Y94.832 E7.34859 F3000
+G1 X107.644 Y95.250 E7.36525 F3000
+G1 X107.896 Y95.682 E7.38191 F3000
+G1 X108.124 Y96.127 E7.39857 F3000
+G1 X108.327 Y96.585 E7.41524 F3000
+G1 X108.504 Y97.053 E7.43190 F3000
+G1 X108.654 Y97.530 E7.44856 F3000
+G1 X108.778 Y98.015 E7.46522 F3000
+G1 X108.875 Y98.506 E7.48188 F3000
+G1 X108.944 Y99.001 E7.49855 F3000
+G1 X108.986 Y99.500 E7.51521 F3000
+G1 X109.000 Y100.000 E7.53187 F3000
+
+; circle r=6 chord=0.6
+G0 X106.000 Y100.000 F6000
+G1 X105.969 Y100.607 E7.55211 F3000
+G1 X105.877 Y101.208 E7.57235 F3000
+G1 X105.725 Y101.796 E7.59259 F3000
+G1 X105.514 Y102.366 E7.61283 F3000
+G1 X105.246 Y102.912 E7.63307 F3000
+G1 X104.925 Y103.428 E7.65331 F3000
+G1 X104.553 Y103.908 E7.67355 F3000
+G1 X104.134 Y104.349 E7.69379 F3000
+G1 X103.673 Y104.745 E7.71403 F3000
+G1 X103.174 Y105.092 E7.73426 F3000
+G1 X102.642 Y105.387 E7.75450 F3000
+G1 X102.084 Y105.627 E7.77474 F3000
+G1 X101.504 Y105.808 E7.79498 F3000
+G1 X100.909 Y105.931 E7.81522 F3000
+G1 X100.304 Y105.992 E7.83546 F3000
+G1 X99.696 Y105.992 E7.85570 F3000
+G1 X99.091 Y105.931 E7.87594 F3000
+G1 X98.496 Y105.808 E7.89618 F3000
+G1 X97.916 Y105.627 E7.91642 F3000
+G1 X97.358 Y105.387 E7.93666 F3000
+G1 X96.826 Y105.092 E7.95690 F3000
+G1 X96.327 Y104.745 E7.97714 F3000
+G1 X95.866 Y104.349 E7.99738 F3000
+G1 X95.447 Y103.908 E8.01762 F3000
+G1 X95.075 Y103.428 E8.03786 F3000
+G1 X94.754 Y102.912 E8.05810 F3000
+G1 X94.486 Y102.366 E8.07833 F3000
+G1 X94.275 Y101.796 E8.09857 F3000
+G1 X94.123 Y101.208 E8.11881 F3000
+G1 X94.031 Y100.607 E8.13905 F3000
+G1 X94.000 Y100.000 E8.15929 F3000
+G1 X94.031 Y99.393 E8.17953 F3000
+G1 X94.123 Y98.792 E8.19977 F3000
+G1 X94.275 Y98.204 E8.22001 F3000
+G1 X94.486 Y97.634 E8.24025 F3000
+G1 X94.754 Y97.088 E8.26049 F3000
+G1 X95.075 Y96.572 E8.28073 F3000
+G1 X95.447 Y96.092 E8.30097 F3000
+G1 X95.866 Y95.651 E8.32121 F3000
+G1 X96.327 Y95.255 E8.34145 F3000
+G1 X96.826 Y94.908 E8.36169 F3000
+G1 X97.358 Y94.613 E8.38193 F3000
+G1 X97.916 Y94.373 E8.40217 F3000
+G1 X98.496 Y94.192 E8.42240 F3000
+G1 X99.091 Y94.069 E8.44264 F3000
+G1 X99.696 Y94.008 E8.46288 F3000
+G1 X100.304 Y94.008 E8.48312 F3000
+G1 X100.909 Y94.069 E8.50336 F3000
+G1 X101.504 Y94.192 E8.52360 F3000
+G1 X102.084 Y94.373 E8.54384 F3000
+G1 X102.642 Y94.613 E8.56408 F3000
+G1 X103.174 Y94.908 E8.58432 F3000
+G1 X103.673 Y95.255 E8.60456 F3000
+G1 X104.134 Y95.651 E8.62480 F3000
+G1 X104.553 Y96.092 E8.64504 F3000
+G1 X104.925 Y96.572 E8.66528 F3000
+G1 X105.246 Y97.088 E8.68552 F3000
+G1 X105.514 Y97.634 E8.70576 F3000
+G1 X105.725 Y98.204 E8.72600 F3000
+G1 X105.877 Y98.792 E8.74624 F3000
+G1 X105.969 Y99.393 E8.76647 F3000
+G1 X106.000 Y100.000 E8.78671 F3000
+
+; the same walls as arcs
+G0 Z0.6 F600
+G0 X115.000 Y100.000 F6000
+G2 X115.000 Y100.000 I-15 J0 E11.92517 F3000
+G0 X112.000 Y100.000 F6000
+G2 X112.000 Y100.000 I-12 J0 E14.43593 F3000
+G0 X109.000 Y100.000 F6000
+G2 X109.000 Y100.000 I-9 J0 E16.31900 F3000
+G0 X106.000 Y100.000 F6000
+G2 X106.000 Y100.000 I-6 J0 E17.57438 F3000
+
+M107
+M400